@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/exit_codes.h>
 #include <util/invariant.h>
 #include <util/make_unique.h>
+#include <util/string2int.h>
 #include <util/unicode.h>
 #include <util/version.h>
 #include <util/xml.h>
@@ -216,6 +217,89 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("depth"))
     options.set_option("depth", cmdline.get_value("depth"));
 
+  if(cmdline.isset("parallel-properties"))
+  {
+    const auto number_of_workers =
+      string2optional_unsigned(cmdline.get_value("parallel-properties"));
+    if(!number_of_workers.has_value() || *number_of_workers == 0)
+    {
+      log.error() << "--parallel-properties expects a positive number of "
+                  << "worker processes" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "parallel-properties", cmdline.get_value("parallel-properties"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --parallel-properties"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("cube-and-conquer"))
+  {
+    const auto number_of_cubes =
+      string2optional_unsigned(cmdline.get_value("cube-and-conquer"));
+    if(!number_of_cubes.has_value() || *number_of_cubes < 2)
+    {
+      log.error() << "--cube-and-conquer expects a number of cubes of at "
+                  << "least 2" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "cube-and-conquer", cmdline.get_value("cube-and-conquer"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --cube-and-conquer"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("parallel-properties"))
+    {
+      log.error() << "--parallel-properties not supported with "
+                  << "--cube-and-conquer" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("solver-cache"))
+  {
+    options.set_option("solver-cache", cmdline.get_value("solver-cache"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --solver-cache"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("parallel-paths"))
+  {
+    const auto number_of_workers =
+      string2optional_unsigned(cmdline.get_value("parallel-paths"));
+    if(!number_of_workers.has_value() || *number_of_workers == 0)
+    {
+      log.error() << "--parallel-paths expects a positive number of "
+                  << "worker processes" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("parallel-paths", cmdline.get_value("parallel-paths"));
+
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--parallel-paths requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
   if(cmdline.isset("debug-level"))
     options.set_option("debug-level", cmdline.get_value("debug-level"));
 
@@ -268,6 +352,12 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
     "slice-formula",
     cmdline.isset("slice-formula"));
 
+  if(cmdline.isset("simplify-formula"))
+    options.set_option("simplify-formula", true);
+
+  if(cmdline.isset("stream-formula"))
+    options.set_option("stream-formula", true);
+
   // simplify if conditions and branches
   if(cmdline.isset("no-simplify-if"))
     options.set_option("simplify-if", false);
@@ -457,6 +547,39 @@ void jbmc_parse_optionst::get_command_line_options(optionst &options)
 
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
+
+  if(cmdline.isset("symex-hash-consing"))
+    options.set_option("symex-hash-consing", true);
+
+  if(cmdline.isset("symex-simplify-cache"))
+  {
+    const auto max_entries =
+      string2optional_unsigned(cmdline.get_value("symex-simplify-cache"));
+    if(!max_entries.has_value())
+    {
+      log.error() << "--symex-simplify-cache expects a number of entries"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "symex-simplify-cache", cmdline.get_value("symex-simplify-cache"));
+  }
+
+  if(cmdline.isset("symex-function-summaries"))
+    options.set_option("symex-function-summaries", true);
+
+  // the worker processes cannot pass counterexample traces back; this is
+  // checked last as other options, e.g. --graphml-witness, imply traces
+  if(
+    options.is_set("parallel-paths") &&
+    (options.get_bool_option("trace") ||
+     options.get_bool_option("stop-on-fail")))
+  {
+    log.error() << "--parallel-paths not supported with traces or "
+                << "--stop-on-fail" << messaget::eom;
+    exit(CPROVER_EXIT_USAGE_ERROR);
+  }
 }
 
 /// invoke main modules
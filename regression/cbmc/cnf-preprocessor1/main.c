@@ -0,0 +1,11 @@
+int main()
+{
+  unsigned char a, b;
+  unsigned char sum = a + b;
+
+  __CPROVER_assume(a == 100);
+  __CPROVER_assert(sum != 142, "reachable");
+  __CPROVER_assert(sum - b == a, "holds");
+
+  return 0;
+}
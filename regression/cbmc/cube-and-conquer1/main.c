@@ -0,0 +1,18 @@
+int main()
+{
+  int x, y, z;
+
+  if(x > 0)
+    y = x;
+  else
+    y = -x;
+
+  if(z > 10)
+    z = 10;
+
+  __CPROVER_assert(y >= 0 || x == -2147483647 - 1, "first");
+  __CPROVER_assert(z <= 10, "second");
+  __CPROVER_assert(y != 5, "third");
+
+  return 0;
+}
@@ -0,0 +1,12 @@
+int main()
+{
+  int x = 0;
+
+  for(int i = 0; i < 10; ++i)
+  {
+    __CPROVER_assert(x < 3, "x");
+    ++x;
+  }
+
+  return 0;
+}
@@ -0,0 +1,21 @@
+int main()
+{
+  int x, y, z;
+
+  if(x > 0)
+  {
+    if(y > 0)
+      __CPROVER_assert(x + y != 2, "x and y");
+    else
+      __CPROVER_assert(y <= 0, "y");
+  }
+  else
+  {
+    if(z > 0)
+      __CPROVER_assert(x <= 0, "x");
+    else
+      __CPROVER_assert(z != -5, "z");
+  }
+
+  return 0;
+}
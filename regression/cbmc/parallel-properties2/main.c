@@ -0,0 +1,16 @@
+int main()
+{
+  int x, y;
+  __CPROVER_assume(x >= 100 && y <= 1000 && x > y + 2);
+  x--;
+  __CPROVER_assert(x > y, "first");
+  x--;
+  __CPROVER_assert(x > y, "second");
+  x--;
+  __CPROVER_assert(x > y, "third");
+  y = 0;
+  __CPROVER_assert(x > y, "fourth");
+  __CPROVER_assert(x < 100, "fifth");
+
+  return 0;
+}
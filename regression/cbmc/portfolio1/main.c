@@ -0,0 +1,10 @@
+int main()
+{
+  int x;
+  int y = x * 3;
+
+  __CPROVER_assert(y != x * 3 + 1, "first");
+  __CPROVER_assert(y != 6, "second");
+
+  return 0;
+}
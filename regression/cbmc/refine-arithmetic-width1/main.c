@@ -0,0 +1,17 @@
+int main()
+{
+  unsigned x, y;
+  unsigned long long u, v;
+
+  __CPROVER_assume(x > 1 && y > 1 && x < 1000 && y < 1000);
+  __CPROVER_assume(u > 1 && v > 1 && u < 1000 && v < 1000);
+
+  // 32 bits, converted eagerly
+  __CPROVER_assert(x * y != 391, "narrow");
+
+  // 64 bits, refined when needed
+  __CPROVER_assert(u * v != 391, "wide");
+  __CPROVER_assert(u * v / v == u, "division");
+
+  return 0;
+}
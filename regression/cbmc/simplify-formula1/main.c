@@ -0,0 +1,17 @@
+int main()
+{
+  _Bool c;
+  int x;
+
+  // the join produces a choice between constants
+  if(c)
+    x = 1;
+  else
+    x = 2;
+
+  int y = x;
+  __CPROVER_assert(y == 1 || y == 2, "in range");
+  __CPROVER_assert(y + 1 == 2, "depends on c");
+
+  return 0;
+}
@@ -0,0 +1,14 @@
+int main()
+{
+  int i = 0;
+  int sum = 0;
+
+  while(i < 10)
+  {
+    sum += i;
+    ++i;
+    __CPROVER_assert(sum != 10, "sum");
+  }
+
+  return 0;
+}
@@ -0,0 +1,15 @@
+int main()
+{
+  int x;
+  __CPROVER_assume(x > 0 && x < 10);
+
+  for(int i = 0; i < 3; ++i)
+  {
+    x += 2;
+    __CPROVER_assert(x > 2, "positive");
+  }
+
+  __CPROVER_assert(x != 15, "not fifteen");
+
+  return 0;
+}
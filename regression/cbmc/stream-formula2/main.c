@@ -0,0 +1,19 @@
+#include <assert.h>
+#include <stdlib.h>
+
+int main()
+{
+  int n;
+  __CPROVER_assume(n > 0 && n < 4);
+
+  int *p = malloc(sizeof(int));
+  *p = 0;
+
+  for(int i = 0; i < n; ++i)
+    *p += 2;
+
+  assert(*p <= 6);
+  assert(*p != 6);
+
+  return 0;
+}
@@ -0,0 +1,14 @@
+int main()
+{
+  unsigned a, b, c;
+
+  // the same adder is built twice
+  unsigned x = a + b;
+  unsigned y = b + a;
+  __CPROVER_assert(x == y, "commutative");
+
+  c = x * y;
+  __CPROVER_assert(c != 4, "square");
+
+  return 0;
+}
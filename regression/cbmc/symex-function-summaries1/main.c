@@ -0,0 +1,32 @@
+int scale;
+
+int clamp(int x)
+{
+  int result;
+  if(x < 0)
+    result = 0;
+  else
+    result = x * scale;
+  return result;
+}
+
+int main()
+{
+  int a;
+  scale = 2;
+
+  // the second and third call reuse the result of the first one
+  int r1 = clamp(a);
+  int r2 = clamp(a);
+  __CPROVER_assert(r1 == r2, "same arguments");
+
+  int r3 = clamp(a);
+  __CPROVER_assert(r3 >= 0 || a > 0, "clamped");
+
+  // a different value of the global requires executing the body
+  scale = 3;
+  int r4 = clamp(a);
+  __CPROVER_assert(a <= 0 || r4 == r1, "scale changed");
+
+  return 0;
+}
@@ -0,0 +1,18 @@
+int nondet_int();
+
+int main()
+{
+  int a[4];
+  int i = nondet_int();
+  __CPROVER_assume(i >= 0 && i < 4);
+
+  for(int j = 0; j < 4; ++j)
+    a[j] = a[i] + j;
+
+  int x = a[i] + 1;
+  int y = a[i] + 1;
+  __CPROVER_assert(x == y, "equal expressions");
+  __CPROVER_assert(a[0] == a[1], "distinct expressions");
+
+  return 0;
+}
@@ -0,0 +1,18 @@
+#!/usr/bin/env bash
+
+goto_cc=$1
+cbmc=$2
+is_windows=$3
+
+options=${*:4:$#-4}
+name=${*:$#}
+base_name=${name%.c}
+
+# compile only: the goto binary has no entry point
+if [[ "${is_windows}" == "true" ]]; then
+  "${goto_cc}" /c "${name}" /Fo"${base_name}.gb"
+else
+  "${goto_cc}" -c "${name}" -o "${base_name}.gb"
+fi
+
+"${cbmc}" "${base_name}.gb" ${options}
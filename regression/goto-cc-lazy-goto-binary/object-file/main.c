@@ -0,0 +1,21 @@
+#include <assert.h>
+
+int global;
+
+void increment(int *x)
+{
+  ++*x;
+}
+
+void unused(void)
+{
+  assert(0);
+}
+
+int main(void)
+{
+  increment(&global);
+  assert(global == 1);
+  assert(global == 2);
+  return 0;
+}
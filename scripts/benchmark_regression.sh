@@ -0,0 +1,81 @@
+#!/bin/bash
+
+# Compares the runtime and the peak resident set size of two builds of CBMC,
+# e.g., with and without IREP_POOL_ALLOCATOR, on the CORE tests of a
+# regression test suite. Tests are run without checking their expected
+# output. Requires GNU time.
+
+set -e
+
+if [[ "$#" -lt 2 || "$#" -gt 3 ]]
+then
+  echo "Usage: $0 baseline-cbmc modified-cbmc [test-directory]"
+  echo "test-directory defaults to regression/cbmc"
+  exit 1
+fi
+
+baseline=$(realpath "$1")
+modified=$(realpath "$2")
+test_directory=${3:-$(git rev-parse --show-toplevel)/regression/cbmc}
+
+gnu_time=${GNU_TIME:-/usr/bin/time}
+
+if ! [[ -x $gnu_time ]]
+then
+  echo "GNU time is required, set GNU_TIME if it is not /usr/bin/time"
+  exit 1
+fi
+
+timing_file=$(mktemp)
+trap 'rm -f "$timing_file"' EXIT
+
+# prints "seconds peak-kilobytes" for running the given command
+measure()
+{
+  "$gnu_time" -f "%e %M" -o "$timing_file" "$@" > /dev/null 2>&1 || true
+  tail -n 1 "$timing_file"
+}
+
+echo "test,baseline_s,modified_s,baseline_kb,modified_kb"
+
+total_baseline_s=0
+total_modified_s=0
+total_baseline_kb=0
+total_modified_kb=0
+
+for desc in "$test_directory"/*/*.desc
+do
+  [[ $(head -n 1 "$desc") == CORE* ]] || continue
+
+  test=$(dirname "$desc")
+  file=$(sed -n 2p "$desc")
+  # options are deliberately split at white space
+  options=$(sed -n 3p "$desc")
+
+  pushd "$test" > /dev/null
+  # shellcheck disable=SC2086
+  read -r baseline_s baseline_kb < <(measure "$baseline" $options "$file")
+  # shellcheck disable=SC2086
+  read -r modified_s modified_kb < <(measure "$modified" $options "$file")
+  popd > /dev/null
+
+  name=$(basename "$test")/$(basename "$desc")
+  echo "$name,$baseline_s,$modified_s,$baseline_kb,$modified_kb"
+
+  total_baseline_s=$(awk "BEGIN { print $total_baseline_s + $baseline_s }")
+  total_modified_s=$(awk "BEGIN { print $total_modified_s + $modified_s }")
+  total_baseline_kb=$((total_baseline_kb + baseline_kb))
+  total_modified_kb=$((total_modified_kb + modified_kb))
+done
+
+echo "total,$total_baseline_s,$total_modified_s,$total_baseline_kb,$total_modified_kb"
+
+# summary on stderr, such that stdout remains valid CSV
+awk "BEGIN {
+  if($total_baseline_s > 0)
+    printf \"runtime change: %+.1f%%\\n\",
+      100 * ($total_modified_s - $total_baseline_s) / $total_baseline_s
+  if($total_baseline_kb > 0)
+    printf \"peak RSS change (sum over tests): %+.1f%%\\n\",
+      100 * ($total_modified_kb - $total_baseline_kb) / $total_baseline_kb
+}" >&2
@@ -21,6 +21,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/exit_codes.h>
 #include <util/invariant.h>
 #include <util/make_unique.h>
+#include <util/string2int.h>
 #include <util/unicode.h>
 #include <util/version.h>
 
@@ -39,6 +40,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-checker/all_properties_verifier_with_trace_storage.h>
 #include <goto-checker/bmc_util.h>
 #include <goto-checker/cover_goals_verifier_with_trace_storage.h>
+#include <goto-checker/incremental_unwind_symex_checker.h>
 #include <goto-checker/multi_path_symex_checker.h>
 #include <goto-checker/multi_path_symex_only_checker.h>
 #include <goto-checker/properties.h>
@@ -240,6 +242,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("drop-unused-functions"))
     options.set_option("drop-unused-functions", true);
 
+  if(cmdline.isset("lazy-goto-binary"))
+    options.set_option("lazy-goto-binary", true);
+
   if(cmdline.isset("havoc-undefined-functions"))
     options.set_option("havoc-undefined-functions", true);
 
@@ -281,6 +286,89 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("depth"))
     options.set_option("depth", cmdline.get_value("depth"));
 
+  if(cmdline.isset("parallel-properties"))
+  {
+    const auto number_of_workers =
+      string2optional_unsigned(cmdline.get_value("parallel-properties"));
+    if(!number_of_workers.has_value() || *number_of_workers == 0)
+    {
+      log.error() << "--parallel-properties expects a positive number of "
+                  << "worker processes" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "parallel-properties", cmdline.get_value("parallel-properties"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --parallel-properties"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("cube-and-conquer"))
+  {
+    const auto number_of_cubes =
+      string2optional_unsigned(cmdline.get_value("cube-and-conquer"));
+    if(!number_of_cubes.has_value() || *number_of_cubes < 2)
+    {
+      log.error() << "--cube-and-conquer expects a number of cubes of at "
+                  << "least 2" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "cube-and-conquer", cmdline.get_value("cube-and-conquer"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --cube-and-conquer"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("parallel-properties"))
+    {
+      log.error() << "--parallel-properties not supported with "
+                  << "--cube-and-conquer" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("solver-cache"))
+  {
+    options.set_option("solver-cache", cmdline.get_value("solver-cache"));
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --solver-cache"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
+  if(cmdline.isset("parallel-paths"))
+  {
+    const auto number_of_workers =
+      string2optional_unsigned(cmdline.get_value("parallel-paths"));
+    if(!number_of_workers.has_value() || *number_of_workers == 0)
+    {
+      log.error() << "--parallel-paths expects a positive number of "
+                  << "worker processes" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("parallel-paths", cmdline.get_value("parallel-paths"));
+
+    if(!cmdline.isset("paths"))
+    {
+      log.error() << "--parallel-paths requires --paths" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+  }
+
   if(cmdline.isset("debug-level"))
     options.set_option("debug-level", cmdline.get_value("debug-level"));
 
@@ -331,6 +419,12 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("slice-formula"))
     options.set_option("slice-formula", true);
 
+  if(cmdline.isset("simplify-formula"))
+    options.set_option("simplify-formula", true);
+
+  if(cmdline.isset("stream-formula"))
+    options.set_option("stream-formula", true);
+
   // simplify if conditions and branches
   if(cmdline.isset("no-simplify-if"))
     options.set_option("simplify-if", false);
@@ -343,6 +437,17 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("dimacs"))
     options.set_option("dimacs", true);
 
+  if(cmdline.isset("binary-cnf"))
+  {
+    if(!cmdline.isset("dimacs"))
+    {
+      log.error() << "--binary-cnf requires --dimacs" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("binary-cnf", true);
+  }
+
   if(cmdline.isset("refine-arrays"))
   {
     options.set_option("refine", true);
@@ -355,6 +460,23 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     options.set_option("refine-arithmetic", true);
   }
 
+  if(cmdline.isset("refine-arithmetic-width"))
+  {
+    const auto width =
+      string2optional_unsigned(cmdline.get_value("refine-arithmetic-width"));
+    if(!width.has_value())
+    {
+      log.error() << "--refine-arithmetic-width expects a width in bits"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("refine", true);
+    options.set_option("refine-arithmetic", true);
+    options.set_option(
+      "refine-arithmetic-width", cmdline.get_value("refine-arithmetic-width"));
+  }
+
   if(cmdline.isset("refine"))
   {
     options.set_option("refine", true);
@@ -397,6 +519,39 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     }
   }
 
+  if(cmdline.isset("incremental-unwind"))
+  {
+    if(cmdline.isset("incremental-loop"))
+    {
+      log.error()
+        << "--incremental-unwind not supported with --incremental-loop"
+        << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("paths"))
+    {
+      log.error() << "--paths not supported with --incremental-unwind"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    if(cmdline.isset("unwind"))
+    {
+      log.error() << "--unwind not supported with --incremental-unwind, "
+                  << "use --unwind-min and --unwind-max" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("incremental-unwind", true);
+
+    if(cmdline.isset("unwind-min"))
+      options.set_option("unwind-min", cmdline.get_value("unwind-min"));
+
+    if(cmdline.isset("unwind-max"))
+      options.set_option("unwind-max", cmdline.get_value("unwind-max"));
+  }
+
   // SMT Options
 
   if(cmdline.isset("smt1"))
@@ -463,6 +618,9 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
     }
   }
 
+  if(cmdline.isset("smt2-interactive"))
+    options.set_option("smt2-interactive", true);
+
   if(cmdline.isset("write-solver-stats-to"))
   {
     options.set_option(
@@ -475,6 +633,38 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("no-sat-preprocessor"))
     options.set_option("sat-preprocessor", false);
 
+  if(cmdline.isset("structural-hashing"))
+    options.set_option("structural-hashing", true);
+
+  if(cmdline.isset("portfolio"))
+  {
+    if(
+      solver_set || cmdline.isset("smt2") || cmdline.isset("dimacs") ||
+      cmdline.isset("refine") || cmdline.isset("refine-strings"))
+    {
+      log.error() << "--portfolio cannot be combined with another solver"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("portfolio", cmdline.get_value("portfolio"));
+  }
+
+  if(cmdline.isset("cnf-preprocessor"))
+  {
+    if(
+      solver_set || cmdline.isset("smt2") || cmdline.isset("dimacs") ||
+      cmdline.isset("refine") || cmdline.isset("refine-strings") ||
+      cmdline.isset("portfolio"))
+    {
+      log.error() << "--cnf-preprocessor cannot be combined with another "
+                  << "solver" << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option("cnf-preprocessor", true);
+  }
+
   if(cmdline.isset("no-pretty-names"))
     options.set_option("pretty-names", false);
 
@@ -509,7 +699,40 @@ void cbmc_parse_optionst::get_command_line_options(optionst &options)
   if(cmdline.isset("show-goto-symex-steps"))
     options.set_option("show-goto-symex-steps", true);
 
+  if(cmdline.isset("symex-hash-consing"))
+    options.set_option("symex-hash-consing", true);
+
+  if(cmdline.isset("symex-simplify-cache"))
+  {
+    const auto max_entries =
+      string2optional_unsigned(cmdline.get_value("symex-simplify-cache"));
+    if(!max_entries.has_value())
+    {
+      log.error() << "--symex-simplify-cache expects a number of entries"
+                  << messaget::eom;
+      exit(CPROVER_EXIT_USAGE_ERROR);
+    }
+
+    options.set_option(
+      "symex-simplify-cache", cmdline.get_value("symex-simplify-cache"));
+  }
+
+  if(cmdline.isset("symex-function-summaries"))
+    options.set_option("symex-function-summaries", true);
+
   PARSE_OPTIONS_GOTO_TRACE(cmdline, options);
+
+  // the worker processes cannot pass counterexample traces back; this is
+  // checked last as other options, e.g. --graphml-witness, imply traces
+  if(
+    options.is_set("parallel-paths") &&
+    (options.get_bool_option("trace") ||
+     options.get_bool_option("stop-on-fail")))
+  {
+    log.error() << "--parallel-paths not supported with traces or "
+                << "--stop-on-fail" << messaget::eom;
+    exit(CPROVER_EXIT_USAGE_ERROR);
+  }
 }
 
 /// invoke main modules
@@ -707,6 +930,21 @@ int cbmc_parse_optionst::doit()
         options, ui_message_handler, goto_model);
     }
   }
+  else if(options.get_bool_option("incremental-unwind"))
+  {
+    if(options.get_bool_option("stop-on-fail"))
+    {
+      verifier = util_make_unique<
+        stop_on_fail_verifiert<incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+    else
+    {
+      verifier = util_make_unique<all_properties_verifier_with_trace_storaget<
+        incremental_unwind_symex_checkert>>(
+        options, ui_message_handler, goto_model);
+    }
+  }
   else if(
     options.get_bool_option("stop-on-fail") && options.get_bool_option("paths"))
   {
@@ -1085,6 +1323,8 @@ void cbmc_parse_optionst::help()
     HELP_REACHABILITY_SLICER_FB
     " --full-slice                 run full slicer (experimental)\n" // NOLINT(*)
     " --drop-unused-functions      drop functions trivially unreachable from main function\n" // NOLINT(*)
+    " --lazy-goto-binary           only read the functions of a goto binary that\n" // NOLINT(*)
+    "                              may be reachable from the entry point\n"
     " --havoc-undefined-functions\n"
     "                              for any function that has no body, assign non-deterministic values to\n" // NOLINT(*)
     "                              any parameters passed as non-const pointers and the return value\n" // NOLINT(*)
@@ -1099,6 +1339,8 @@ void cbmc_parse_optionst::help()
     "Backend options:\n"
     " --object-bits n              number of bits used for object addresses\n"
     " --dimacs                     generate CNF in DIMACS format\n"
+    " --binary-cnf                 with --dimacs and --outfile, write the CNF\n"
+    "                              in a compact binary format\n"
     " --beautify                   beautify the counterexample (greedy heuristic)\n" // NOLINT(*)
     " --localize-faults            localize faults (experimental)\n"
     " --smt2                       use default SMT2 solver (Z3)\n"
@@ -1108,7 +1350,18 @@ void cbmc_parse_optionst::help()
     " --mathsat                    use MathSAT\n"
     " --yices                      use Yices\n"
     " --z3                         use Z3\n"
+    " --smt2-interactive           keep the SMT2 solver running and send it\n"
+    "                              only new parts of the formula\n"
     " --refine                     use refinement procedure (experimental)\n"
+    " --refine-arithmetic-width n  build multiplication, division and\n"
+    "                              remainder circuits of n or more bits only\n"
+    "                              when refuting a spurious counterexample\n"
+    " --portfolio solvers          race the given comma-separated SAT solvers\n"
+    "                              and take the first answer\n"
+    " --cnf-preprocessor           simplify the CNF before passing it to the\n"
+    "                              SAT solver, in place of its own simplifier\n"
+    " --structural-hashing         share Boolean gates over the same inputs\n"
+    "                              when generating CNF\n"
     HELP_STRING_REFINEMENT_CBMC
     " --outfile filename           output formula to given file\n"
     " --arrays-uf-never            never turn arrays into uninterpreted functions\n" // NOLINT(*)
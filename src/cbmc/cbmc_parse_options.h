@@ -56,10 +56,14 @@ class optionst;
   OPT_XML_INTERFACE \
   OPT_JSON_INTERFACE \
   "(smt1)(smt2)(fpa)(cvc3)(cvc4)(boolector)(yices)(z3)(mathsat)" \
-  "(cprover-smt2)" \
+  "(cprover-smt2)(smt2-interactive)" \
   "(no-sat-preprocessor)" \
+  "(structural-hashing)" \
+  "(cnf-preprocessor)" \
+  "(portfolio):" \
   "(beautify)" \
-  "(dimacs)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)"\
+  "(dimacs)(binary-cnf)(refine)(max-node-refinement):(refine-arrays)(refine-arithmetic)" \
+  "(refine-arithmetic-width):" \
   OPT_STRING_REFINEMENT_CBMC \
   "(16)(32)(64)(LP64)(ILP64)(LLP64)(ILP32)(LP32)" \
   "(little-endian)(big-endian)" \
@@ -67,6 +71,7 @@ class optionst;
   OPT_SHOW_PROPERTIES \
   "(show-symbol-table)(show-parse-tree)" \
   "(drop-unused-functions)" \
+  "(lazy-goto-binary)" \
   "(havoc-undefined-functions)" \
   "(property):(stop-on-fail)(trace)" \
   "(error-label):(verbosity):(no-library)" \
@@ -20,6 +20,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include <goto-symex/build_goto_trace.h>
 #include <goto-symex/memory_model_pso.h>
+#include <goto-symex/simplify_equation.h>
 #include <goto-symex/slice.h>
 #include <goto-symex/symex_target_equation.h>
 
@@ -252,7 +253,8 @@ void update_properties_status_from_symex_target_equation(
     const auto status = step.cond_expr.is_true() ? property_statust::PASS
                                                  : property_statust::UNKNOWN;
     auto emplace_result = properties.emplace(
-      property_id, property_infot{step.source.pc, step.comment, status});
+      property_id,
+      property_infot{step.source.pc, id2string(step.comment), status});
 
     if(emplace_result.second)
     {
@@ -340,6 +342,25 @@ void postprocess_equation(
 
   slice(symex, equation, ns, options, ui_message_handler);
 
+  if(options.get_bool_option("simplify-formula"))
+  {
+    if(equation.has_threads())
+    {
+      log.statistics() << "no formula simplification due to threads"
+                       << messaget::eom;
+    }
+    else
+    {
+      const auto statistics = simplify_equation(equation, ns);
+      log.statistics() << "formula simplification propagated "
+                       << statistics.propagated_symbols << " symbols, "
+                       << "rewrote " << statistics.rewritten_expressions
+                       << " expressions and decided "
+                       << statistics.decided_conditions << " conditions"
+                       << messaget::eom;
+    }
+  }
+
   if(options.get_bool_option("validate-ssa-equation"))
   {
     symex.validate(validation_modet::INVARIANT);
@@ -85,6 +85,7 @@ void slice(
 /// Post process the equation
 /// - add partial order constraints
 /// - slice
+/// - simplify, see \ref simplify_equation
 /// - perform validation
 void postprocess_equation(
   symex_bmct &symex,
@@ -176,7 +177,12 @@ void run_property_decider(
   "(show-loops)" \
   "(show-vcc)" \
   "(show-goto-symex-steps)" \
+  "(symex-hash-consing)" \
+  "(symex-simplify-cache):" \
+  "(symex-function-summaries)" \
   "(slice-formula)" \
+  "(simplify-formula)" \
+  "(stream-formula)" \
   "(unwinding-assertions)" \
   "(no-unwinding-assertions)" \
   "(no-pretty-names)" \
@@ -193,15 +199,31 @@ void run_property_decider(
   "(symex-complexity-limit):" \
   "(symex-complexity-failed-child-loops-limit):" \
   "(incremental-loop):" \
+  "(incremental-unwind)" \
   "(unwind-min):" \
   "(unwind-max):" \
-  "(ignore-properties-before-unwind-min)"
+  "(ignore-properties-before-unwind-min)" \
+  "(parallel-properties):" \
+  "(cube-and-conquer):" \
+  "(parallel-paths):" \
+  "(solver-cache):"
 
 #define HELP_BMC \
   " --paths [strategy]           explore paths one at a time\n" \
   " --show-symex-strategies      list strategies for use with --paths\n" \
+  " --parallel-paths n           explore paths using n worker processes\n" \
+  "                              (requires --paths, without traces); a\n" \
+  "                              process with saved paths hands one over\n" \
+  "                              whenever a process is idle, but paths are\n" \
+  "                              never handed back\n" \
   " --show-goto-symex-steps      show which steps symex travels, includes " \
   "                              diagnostic information\n" \
+  " --symex-hash-consing         share structurally equal expressions\n" \
+  "                              assigned during symbolic execution\n" \
+  " --symex-simplify-cache n     keep up to n simplification results for\n" \
+  "                              reuse during symbolic execution\n" \
+  " --symex-function-summaries   reuse the return values of earlier calls\n" \
+  "                              to functions without side effects\n" \
   " --program-only               only show program expression\n" \
   " --show-loops                 show the loops in the program\n" \
   " --depth nr                   limit search depth\n" \
@@ -220,18 +242,38 @@ void run_property_decider(
   " --incremental-loop L         check properties after each unwinding\n" \
   "                              of loop L\n" \
   "                              (use --show-loops to get the loop IDs)\n" \
+  " --incremental-unwind         check properties with increasing unwinding\n" \
+  "                              bounds for all loops, resuming symbolic\n" \
+  "                              execution where the previous bound was\n" \
+  "                              exceeded\n" \
   " --unwind-min nr              start incremental-loop after nr unwindings\n" \
   "                              but before solving that iteration. If for\n" \
   "                              example it is 1, then the loop will be\n" \
   "                              unwound once, and immediately checked.\n" \
   "                              Note: this means for min-unwind 1 or\n"\
   "                              0 all properties are checked.\n" \
-  " --unwind-max nr              stop incremental-loop after nr unwindings\n" \
+  "                              With --incremental-unwind, nr is the first\n" \
+  "                              bound (default 1).\n" \
+  " --unwind-max nr              stop incremental-loop after nr unwindings.\n" \
+  "                              With --incremental-unwind, nr is the\n" \
+  "                              greatest bound (default unlimited).\n" \
   " --ignore-properties-before-unwind-min\n" \
   "                              do not check properties before unwind-min\n" \
   "                              when using incremental-loop\n" \
+  " --parallel-properties n      decide the properties using n worker\n" \
+  "                              processes\n" \
+  " --cube-and-conquer n         split the search space into at least n\n" \
+  "                              cubes on branch conditions and decide\n" \
+  "                              them using up to n worker processes\n" \
+  " --solver-cache dir           reuse the results of previous runs on the\n" \
+  "                              same formula and build, stored in\n" \
+  "                              directory dir\n" \
   " --show-vcc                   show the verification conditions\n" \
   " --slice-formula              remove assignments unrelated to property\n" \
+  " --simplify-formula           propagate constants and copies through the\n" \
+  "                              formula and simplify it before solving\n" \
+  " --stream-formula             pass the formula to the solver while it is\n" \
+  "                              generated to reduce the memory footprint\n" \
   " --unwinding-assertions       generate unwinding assertions (cannot be\n" \
   "                              used with --cover or --partial-loops)\n" \
   " --partial-loops              permit paths with partial loops\n" \
@@ -0,0 +1,283 @@
+/*******************************************************************\
+
+Module: Cube-and-Conquer Property Decider for Goto-Symex
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cube-and-Conquer Property Decider for Goto-Symex
+
+#include "cube_and_conquer.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <util/exception_utils.h>
+#include <util/make_unique.h>
+#include <util/std_expr.h>
+#include <util/ui_message.h>
+#include <util/worker_process.h>
+
+#include <solvers/stack_decision_procedure.h>
+
+#include "goto_symex_property_decider.h"
+
+/// Returns up to \p max_conditions distinct, non-constant branch conditions
+/// from the converted equation, in the order of the SSA steps
+static std::vector<exprt> splitting_conditions(
+  const symex_target_equationt &equation,
+  std::size_t max_conditions)
+{
+  std::vector<exprt> conditions;
+
+  for(const auto &step : equation.SSA_steps)
+  {
+    if(conditions.size() >= max_conditions)
+      break;
+
+    if(!step.is_goto() || step.ignore || step.cond_handle.is_constant())
+      continue;
+
+    if(
+      std::find(conditions.begin(), conditions.end(), step.cond_handle) ==
+      conditions.end())
+    {
+      conditions.push_back(step.cond_handle);
+    }
+  }
+
+  return conditions;
+}
+
+/// Returns the assumptions that make up cube number \p cube_number: bit i
+/// of \p cube_number decides the polarity of the i-th of \p conditions
+static std::vector<exprt> make_cube(
+  const std::vector<exprt> &conditions,
+  std::size_t cube_number,
+  goto_symex_property_decidert &property_decider)
+{
+  std::vector<exprt> cube;
+  for(std::size_t i = 0; i < conditions.size(); ++i)
+  {
+    if((cube_number >> i) & 1)
+      cube.push_back(conditions[i]);
+    else
+    {
+      cube.push_back(property_decider.get_decision_procedure().handle(
+        not_exprt(conditions[i])));
+    }
+  }
+
+  return cube;
+}
+
+/// Runs in the worker process: decides the properties in
+/// \p properties_to_check under the assumptions given by \p cube
+/// \return one line per property decided, consisting of `P` or `F`
+///   followed by the property ID
+static std::string decide_cube(
+  const std::vector<exprt> &cube,
+  const std::vector<irep_idt> &properties_to_check,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider)
+{
+  property_decider.get_stack_decision_procedure().push(cube);
+
+  std::unordered_set<irep_idt> updated_properties;
+  decision_proceduret::resultt dec_result;
+
+  do
+  {
+    property_decider.add_constraint_from_goals(
+      [&properties](const irep_idt &property_id) {
+        return is_property_to_check(properties.at(property_id).status);
+      });
+
+    dec_result = property_decider.solve();
+
+    property_decider.update_properties_status_from_goals(
+      properties, updated_properties, dec_result);
+  } while(dec_result == decision_proceduret::resultt::D_SATISFIABLE &&
+          has_properties_to_check(properties));
+
+  std::ostringstream out;
+  for(const auto &property_id : properties_to_check)
+  {
+    const property_statust status = properties.at(property_id).status;
+    if(status == property_statust::PASS)
+      out << "P " << property_id << '\n';
+    else if(status == property_statust::FAIL)
+      out << "F " << property_id << '\n';
+  }
+
+  return out.str();
+}
+
+std::vector<failing_cubet> run_cube_and_conquer(
+  incremental_goto_checkert::resultt &result,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider,
+  std::size_t number_of_workers,
+  ui_message_handlert &ui_message_handler)
+{
+  messaget log(ui_message_handler);
+
+  if(!worker_processt::is_supported())
+  {
+    log.warning() << "cube-and-conquer is not supported on this platform"
+                  << messaget::eom;
+    return {};
+  }
+
+  std::vector<irep_idt> properties_to_check;
+  for(const auto &property_pair : properties)
+  {
+    if(is_property_to_check(property_pair.second.status))
+      properties_to_check.push_back(property_pair.first);
+  }
+
+  if(properties_to_check.empty() || number_of_workers < 2)
+    return {};
+
+  std::size_t depth = 0;
+  while((std::size_t(1) << depth) < number_of_workers)
+    ++depth;
+
+  const std::vector<exprt> conditions =
+    splitting_conditions(property_decider.get_equation(), depth);
+
+  if(conditions.empty())
+  {
+    log.warning() << "no branch conditions to split on, not using "
+                  << "cube-and-conquer" << messaget::eom;
+    return {};
+  }
+
+  const std::size_t number_of_cubes = std::size_t(1) << conditions.size();
+
+  log.status() << "Deciding " << properties_to_check.size()
+               << " properties using " << number_of_cubes
+               << " cubes on " << conditions.size() << " branch conditions"
+               << messaget::eom;
+
+  // the workers, indexed by cube; null if not running
+  std::vector<std::unique_ptr<worker_processt>> workers(number_of_cubes);
+  std::size_t running_workers = 0;
+  std::size_t next_cube = 0;
+
+  // the number of cubes in which each property has been proved
+  std::unordered_map<irep_idt, std::size_t> proved_in_cubes;
+
+  // the first cube in which each property has been refuted
+  std::unordered_map<irep_idt, std::size_t> refuted_in_cube;
+
+  while(true)
+  {
+    for(; next_cube < number_of_cubes && running_workers < number_of_workers;
+        ++next_cube)
+    {
+      const std::size_t c = next_cube;
+
+      try
+      {
+        workers[c] = util_make_unique<worker_processt>([&]() {
+          // keep the solver in the worker quiet
+          ui_message_handler.set_verbosity(messaget::M_ERROR);
+
+          return decide_cube(
+            make_cube(conditions, c, property_decider),
+            properties_to_check,
+            properties,
+            property_decider);
+        });
+      }
+      catch(const system_exceptiont &e)
+      {
+        // without all cubes, nothing can be concluded; the destructors
+        // terminate the running workers
+        log.warning() << e.what() << messaget::eom;
+        return {};
+      }
+
+      ++running_workers;
+    }
+
+    const auto ready = wait_for_any_worker(workers);
+    if(!ready.has_value())
+      break;
+
+    const auto output = workers[*ready]->wait();
+    workers[*ready] = nullptr;
+    --running_workers;
+
+    if(!output.has_value())
+    {
+      log.warning() << "worker process failed, the properties are checked "
+                    << "sequentially" << messaget::eom;
+      return {};
+    }
+
+    std::istringstream in(*output);
+    std::string line;
+    while(std::getline(in, line))
+    {
+      if(line.size() < 3)
+        continue;
+
+      const irep_idt property_id = line.substr(2);
+
+      if(line[0] == 'P')
+        ++proved_in_cubes[property_id];
+      else if(line[0] == 'F')
+      {
+        auto entry = refuted_in_cube.emplace(property_id, *ready).first;
+        entry->second = std::min(entry->second, *ready);
+      }
+    }
+  }
+
+  std::size_t proved = 0;
+
+  // the refuted properties, grouped by the first cube refuting them
+  std::map<std::size_t, std::vector<irep_idt>> refuted_by_cube;
+
+  for(const auto &property_id : properties_to_check)
+  {
+    const auto refuted = refuted_in_cube.find(property_id);
+    if(refuted != refuted_in_cube.end())
+    {
+      refuted_by_cube[refuted->second].push_back(property_id);
+      continue;
+    }
+
+    const auto entry = proved_in_cubes.find(property_id);
+    if(entry == proved_in_cubes.end() || entry->second != number_of_cubes)
+      continue;
+
+    properties.at(property_id).status |= property_statust::PASS;
+    result.updated_properties.insert(property_id);
+    ++proved;
+  }
+
+  log.statistics() << "Cubes proved " << proved << " and refuted "
+                   << refuted_in_cube.size() << " of "
+                   << properties_to_check.size() << " properties"
+                   << messaget::eom;
+
+  std::vector<failing_cubet> failing_cubes;
+  for(auto &cube_pair : refuted_by_cube)
+  {
+    failing_cubes.emplace_back();
+    failing_cubes.back().assumptions =
+      make_cube(conditions, cube_pair.first, property_decider);
+    failing_cubes.back().property_ids = std::move(cube_pair.second);
+  }
+
+  return failing_cubes;
+}
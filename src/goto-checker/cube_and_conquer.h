@@ -0,0 +1,76 @@
+/*******************************************************************\
+
+Module: Cube-and-Conquer Property Decider for Goto-Symex
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cube-and-Conquer Property Decider for Goto-Symex
+
+#ifndef CPROVER_GOTO_CHECKER_CUBE_AND_CONQUER_H
+#define CPROVER_GOTO_CHECKER_CUBE_AND_CONQUER_H
+
+#include <vector>
+
+#include <util/expr.h>
+
+#include "incremental_goto_checker.h"
+#include "properties.h"
+
+class goto_symex_property_decidert;
+class ui_message_handlert;
+
+/// A cube in which a worker process has refuted properties
+struct failing_cubet
+{
+  /// The conditions and negated conditions that make up the cube, as
+  /// handles of the decision procedure (see `stack_decision_proceduret::push`)
+  std::vector<exprt> assumptions;
+
+  /// The properties that have been refuted in this cube and in no cube
+  /// before it
+  std::vector<irep_idt> property_ids;
+};
+
+/// Splits the search space of the properties that are still to be checked
+/// into cubes and decides each cube in a worker process.
+///
+/// The splitting variables are the conditions of the first branches in the
+/// equation of \p property_decider that are neither ignored nor constant.
+/// With k such conditions there are 2^k cubes, i.e., all combinations of
+/// these conditions and their negations, where k is the smallest number
+/// such that there are at least \p number_of_workers cubes. Each cube is
+/// decided by a worker process that is forked after the equation has been
+/// passed to the solver and solves under its cube as assumptions (see
+/// `stack_decision_proceduret::push`). At most \p number_of_workers workers
+/// run at the same time.
+///
+/// As the cubes cover all paths, a property is proved if it is proved in
+/// every cube: it is then set to PASS in \p properties and added to
+/// `result.updated_properties`. All other properties remain to be checked:
+/// the caller must still solve for them with \p property_decider, which then
+/// also provides the model that counterexample traces are built from. For
+/// the refuted properties, solving under the returned cubes finds such a
+/// model faster. If a worker fails, nothing is concluded.
+///
+/// On platforms without worker processes (see \ref worker_processt) this
+/// does nothing besides emitting a warning.
+/// \param [in,out] result: For recording the updated properties
+/// \param [in,out] properties: The status of proven properties is set to PASS
+/// \param [in,out] property_decider: A property decider that has been
+///   prepared (see `prepare_property_decider`), but not solved yet
+/// \param number_of_workers: The minimum number of cubes and the maximum
+///   number of worker processes
+/// \param [in,out] ui_message_handler: For logging
+/// \return the cubes in which properties have been refuted, in the order of
+///   the cubes
+std::vector<failing_cubet> run_cube_and_conquer(
+  incremental_goto_checkert::resultt &result,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider,
+  std::size_t number_of_workers,
+  ui_message_handlert &ui_message_handler);
+
+#endif // CPROVER_GOTO_CHECKER_CUBE_AND_CONQUER_H
@@ -0,0 +1,291 @@
+/*******************************************************************\
+
+Module: Goto Checker using Multi-Path Symbolic Execution
+        with Incremental Unwinding of all Loops
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using multi-path symbolic execution with incremental
+/// unwinding of all loops
+
+#include "incremental_unwind_symex_checker.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#include <util/make_unique.h>
+#include <util/suffix.h>
+
+#include "bmc_util.h"
+#include "counterexample_beautification.h"
+
+/// Returns true if \p property_id is an unwinding assertion of a loop or a
+/// recursion
+static bool is_unwinding_assertion(const irep_idt &property_id)
+{
+  const std::string &id = id2string(property_id);
+  return id.find(".unwind.") != std::string::npos ||
+         has_suffix(id, ".recursion");
+}
+
+incremental_unwind_symex_checkert::incremental_unwind_symex_checkert(
+  const optionst &options,
+  ui_message_handlert &ui_message_handler,
+  abstract_goto_modelt &goto_model)
+  : incremental_goto_checkert(options, ui_message_handler),
+    goto_model(goto_model),
+    ns(goto_model.get_symbol_table(), symex_symbol_table),
+    equation(ui_message_handler),
+    symex(
+      ui_message_handler,
+      goto_model.get_symbol_table(),
+      equation,
+      options,
+      path_storage,
+      guard_manager),
+    max_unwind(
+      options.is_set("unwind-max")
+        ? options.get_unsigned_int_option("unwind-max")
+        : std::numeric_limits<unsigned>::max()),
+    unwind(
+      options.is_set("unwind-min")
+        ? std::max(options.get_unsigned_int_option("unwind-min"), 1u)
+        : 1)
+{
+  setup_symex(symex, ns, options, ui_message_handler);
+}
+
+void incremental_unwind_symex_checkert::generate_equation(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  // the solver refers to the equation that is about to be replaced
+  property_decider = nullptr;
+
+  log.status() << "Unwinding loops " << unwind << " times" << messaget::eom;
+
+  const auto get_goto_function = goto_symext::get_goto_function(goto_model);
+  const bool bound_exceeded =
+    resumable
+      ? symex.resume(get_goto_function, symex_symbol_table, unwind)
+      : symex.from_entry_point_of(get_goto_function, symex_symbol_table, unwind);
+
+  resumable = bound_exceeded;
+  final_unwind = !bound_exceeded || unwind >= max_unwind;
+
+  // properties that are trivially true for a smaller bound need not be so
+  // for this one
+  for(auto &property_pair : properties)
+  {
+    if(property_pair.second.status == property_statust::PASS)
+      property_pair.second.status = property_statust::NOT_CHECKED;
+  }
+
+  // This might add new properties such as unwinding assertions, for instance.
+  update_properties_status_from_symex_target_equation(
+    properties, updated_properties, equation);
+
+  property_decider = util_make_unique<goto_symex_property_decidert>(
+    options, ui_message_handler, equation, ns);
+
+  // Freeze all symbols if we are using a prop_conv_solvert
+  prop_conv_solvert *prop_conv_solver = dynamic_cast<prop_conv_solvert *>(
+    &property_decider->get_stack_decision_procedure());
+  if(prop_conv_solver != nullptr)
+    prop_conv_solver->set_all_frozen();
+
+  postprocess_equation(symex, equation, options, ns, ui_message_handler);
+
+  log.status() << "converting SSA" << messaget::eom;
+  equation.convert_without_assertions(
+    property_decider->get_decision_procedure());
+
+  property_decider->update_properties_goals_from_symex_target_equation(
+    properties);
+
+  // We convert the assertions in a new context.
+  property_decider->get_stack_decision_procedure().push();
+  equation.convert_assertions(property_decider->get_decision_procedure(), false);
+  property_decider->convert_goals();
+
+  equation_generated = true;
+}
+
+bool incremental_unwind_symex_checkert::is_selected(
+  const propertiest &properties,
+  const irep_idt &property_id) const
+{
+  return is_property_to_check(properties.at(property_id).status) &&
+         (final_unwind || !is_unwinding_assertion(property_id));
+}
+
+bool incremental_unwind_symex_checkert::unwinding_assertions_hold(
+  const propertiest &properties)
+{
+  if(!options.get_bool_option("unwinding-assertions"))
+    return false;
+
+  property_decider->get_stack_decision_procedure().push();
+  property_decider->add_constraint_from_goals(
+    [&properties](const irep_idt &property_id) {
+      return is_unwinding_assertion(property_id) &&
+             is_property_to_check(properties.at(property_id).status);
+    });
+  const decision_proceduret::resultt dec_result = property_decider->solve();
+  property_decider->get_stack_decision_procedure().pop();
+
+  return dec_result == decision_proceduret::resultt::D_UNSATISFIABLE;
+}
+
+incremental_goto_checkert::resultt incremental_unwind_symex_checkert::
+operator()(propertiest &properties)
+{
+  resultt result(resultt::progresst::DONE);
+
+  std::chrono::duration<double> solver_runtime(0);
+
+  while(true)
+  {
+    if(!equation_generated)
+      generate_equation(properties, result.updated_properties);
+
+    const auto selected = [this, &properties](const irep_idt &property_id) {
+      return is_selected(properties, property_id);
+    };
+
+    if(std::any_of(
+         properties.begin(),
+         properties.end(),
+         [&selected](const propertiest::value_type &property_pair) {
+           return selected(property_pair.first);
+         }))
+    {
+      log.status()
+        << "Running "
+        << property_decider->get_decision_procedure().decision_procedure_text()
+        << messaget::eom;
+
+      const auto solver_start = std::chrono::steady_clock::now();
+
+      property_decider->add_constraint_from_goals(selected);
+      const decision_proceduret::resultt dec_result =
+        property_decider->solve();
+
+      std::unordered_set<irep_idt> updated_properties;
+      property_decider->update_properties_status_from_goals(
+        properties, updated_properties, dec_result, false);
+
+      for(const auto &property_id : updated_properties)
+      {
+        // unwinding assertions that fail for this bound may hold for a
+        // greater one
+        if(!final_unwind && is_unwinding_assertion(property_id))
+          properties.at(property_id).status = property_statust::UNKNOWN;
+        else
+          result.updated_properties.insert(property_id);
+      }
+
+      const auto solver_stop = std::chrono::steady_clock::now();
+      solver_runtime +=
+        std::chrono::duration<double>(solver_stop - solver_start);
+      log.status() << "Runtime decision procedure: " << solver_runtime.count()
+                   << "s" << messaget::eom;
+
+      // We've got a trace to report.
+      if(dec_result == decision_proceduret::resultt::D_SATISFIABLE)
+      {
+        result.progress = resultt::progresst::FOUND_FAIL;
+        return result;
+      }
+
+      if(dec_result == decision_proceduret::resultt::D_ERROR)
+        return result;
+    }
+
+    // Nothing else fails for this bound. Let's pop the assertions.
+    property_decider->get_stack_decision_procedure().pop();
+
+    if(!final_unwind && unwinding_assertions_hold(properties))
+    {
+      log.status() << "All loops are fully unwound with " << unwind
+                   << " unwindings" << messaget::eom;
+      final_unwind = true;
+    }
+
+    if(final_unwind)
+    {
+      update_status_of_unknown_properties(
+        properties, result.updated_properties);
+      update_status_of_not_checked_properties(
+        properties, result.updated_properties);
+      return result;
+    }
+
+    ++unwind;
+    equation_generated = false;
+  }
+}
+
+goto_tracet incremental_unwind_symex_checkert::build_full_trace() const
+{
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation,
+    equation.SSA_steps.end(),
+    property_decider->get_decision_procedure(),
+    ns,
+    goto_trace);
+
+  return goto_trace;
+}
+
+goto_tracet incremental_unwind_symex_checkert::build_shortest_trace() const
+{
+  if(options.get_bool_option("beautify"))
+  {
+    // NOLINTNEXTLINE(whitespace/braces)
+    counterexample_beautificationt{ui_message_handler}(
+      dynamic_cast<boolbvt &>(property_decider->get_stack_decision_procedure()),
+      equation);
+  }
+
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation, property_decider->get_decision_procedure(), ns, goto_trace);
+
+  return goto_trace;
+}
+
+goto_tracet incremental_unwind_symex_checkert::build_trace(
+  const irep_idt &property_id) const
+{
+  goto_tracet goto_trace;
+  build_goto_trace(
+    equation,
+    ssa_step_matches_failing_property(property_id),
+    property_decider->get_decision_procedure(),
+    ns,
+    goto_trace);
+
+  return goto_trace;
+}
+
+const namespacet &incremental_unwind_symex_checkert::get_namespace() const
+{
+  return ns;
+}
+
+void incremental_unwind_symex_checkert::output_proof()
+{
+  output_graphml(equation, ns, options);
+}
+
+void incremental_unwind_symex_checkert::output_error_witness(
+  const goto_tracet &error_trace)
+{
+  output_graphml(error_trace, ns, options);
+}
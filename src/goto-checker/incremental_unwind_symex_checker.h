@@ -0,0 +1,96 @@
+/*******************************************************************\
+
+Module: Goto Checker using Multi-Path Symbolic Execution
+        with Incremental Unwinding of all Loops
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Goto Checker using multi-path symbolic execution with incremental
+/// unwinding of all loops
+
+#ifndef CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
+#define CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
+
+#include <memory>
+
+#include "goto_symex_property_decider.h"
+#include "goto_trace_provider.h"
+#include "incremental_goto_checker.h"
+#include "symex_bmc_incremental_unwind.h"
+#include "witness_provider.h"
+
+/// Performs a multi-path symbolic execution using goto-symex with increasing
+/// unwinding bounds for all loops, starting at `--unwind-min` (default 1),
+/// and calls a SAT/SMT solver to check the properties for each bound.
+///
+/// Symbolic execution for a bound resumes from the checkpoint that was taken
+/// where the first loop exceeded the previous bound, see
+/// \ref symex_bmc_incremental_unwindt. Each bound is decided by a new
+/// solver, as the equations for different bounds only share a prefix.
+///
+/// Properties that fail for a bound fail for all greater bounds. The
+/// remaining properties pass once the equation does not depend on the bound
+/// anymore, or all unwinding assertions hold, or the bound has reached
+/// `--unwind-max`. Below that, unwinding assertions are not reported as
+/// failing, as they may hold for a greater bound.
+class incremental_unwind_symex_checkert : public incremental_goto_checkert,
+                                          public goto_trace_providert,
+                                          public witness_providert
+{
+public:
+  incremental_unwind_symex_checkert(
+    const optionst &options,
+    ui_message_handlert &ui_message_handler,
+    abstract_goto_modelt &goto_model);
+
+  /// \copydoc incremental_goto_checkert::operator()(propertiest &properties)
+  resultt operator()(propertiest &) override;
+
+  goto_tracet build_full_trace() const override;
+  goto_tracet build_trace(const irep_idt &) const override;
+  goto_tracet build_shortest_trace() const override;
+  const namespacet &get_namespace() const override;
+
+  void output_error_witness(const goto_tracet &) override;
+  void output_proof() override;
+
+protected:
+  abstract_goto_modelt &goto_model;
+  symbol_tablet symex_symbol_table;
+  namespacet ns;
+  symex_target_equationt equation;
+  path_fifot path_storage; // should go away
+  guard_managert guard_manager;
+  symex_bmc_incremental_unwindt symex;
+
+  const unsigned max_unwind;
+  unsigned unwind;
+
+  /// Whether symex can be resumed with a greater bound
+  bool resumable = false;
+
+  bool equation_generated = false;
+
+  /// Whether greater bounds do not change the results for the current one
+  bool final_unwind = false;
+
+  std::unique_ptr<goto_symex_property_decidert> property_decider;
+
+  /// Runs symex for the current bound and passes the equation to a new
+  /// solver
+  void generate_equation(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties);
+
+  /// Whether \p property_id is to be checked for the current bound
+  bool is_selected(const propertiest &properties, const irep_idt &property_id)
+    const;
+
+  /// \return true if all unwinding assertions hold for the current bound
+  bool unwinding_assertions_hold(const propertiest &properties);
+};
+
+#endif // CPROVER_GOTO_CHECKER_INCREMENTAL_UNWIND_SYMEX_CHECKER_H
@@ -11,13 +11,18 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "multi_path_symex_checker.h"
 
+#include <algorithm>
 #include <chrono>
 
+#include <util/make_unique.h>
+
 #include <solvers/hardness_collector.h>
 
 #include "bmc_util.h"
 #include "counterexample_beautification.h"
+#include "cube_and_conquer.h"
 #include "goto_symex_fault_localizer.h"
+#include "parallel_property_decider.h"
 
 multi_path_symex_checkert::multi_path_symex_checkert(
   const optionst &options,
@@ -25,8 +30,36 @@ multi_path_symex_checkert::multi_path_symex_checkert(
   abstract_goto_modelt &goto_model)
   : multi_path_symex_only_checkert(options, ui_message_handler, goto_model),
     equation_generated(false),
-    property_decider(options, ui_message_handler, equation, ns)
+    property_decider(options, ui_message_handler, equation, ns),
+    decided_in_parallel(false)
 {
+  if(options.get_bool_option("stream-formula"))
+  {
+    // the steps that are converted while symex records them cannot be
+    // sliced, rewritten or hashed afterwards
+    std::string incompatible_option;
+    if(options.get_bool_option("slice-formula"))
+      incompatible_option = "--slice-formula";
+    else if(options.get_bool_option("simplify-formula"))
+      incompatible_option = "--simplify-formula";
+    else if(options.is_set("solver-cache"))
+      incompatible_option = "--solver-cache";
+    else if(!options.get_option("graphml-witness").empty())
+      incompatible_option = "--graphml-witness";
+
+    if(!incompatible_option.empty())
+    {
+      log.warning() << "--stream-formula is ignored with "
+                    << incompatible_option << messaget::eom;
+    }
+    else
+    {
+      equation.stream_to(
+        property_decider.get_decision_procedure(),
+        ns,
+        options.get_bool_option("validate-ssa-equation"));
+    }
+  }
 }
 
 incremental_goto_checkert::resultt multi_path_symex_checkert::
@@ -58,6 +91,36 @@ operator()(propertiest &properties)
     if(!has_properties_to_check(properties))
       return result;
 
+    // The formula must still be written when it is output rather than solved
+    if(
+      options.is_set("solver-cache") && !options.get_bool_option("dimacs") &&
+      options.get_option("outfile").empty())
+    {
+      if(!solver_result_cache_build_id().has_value())
+      {
+        log.warning() << "--solver-cache is ignored as this build is not "
+                      << "identified by a git revision" << messaget::eom;
+      }
+      else
+      {
+        solver_result_cache = util_make_unique<solver_result_cachet>(
+          options.get_option("solver-cache"),
+          equation,
+          options,
+          ns,
+          ui_message_handler);
+        solver_result_cache->lookup(properties, result.updated_properties);
+
+        // Everything has been proved before: we don't need to pass the
+        // equation to the solver at all.
+        if(!has_properties_to_check(properties))
+        {
+          equation_generated = true;
+          return result;
+        }
+      }
+    }
+
     solver_runtime += prepare_property_decider(properties);
 
     equation_generated = true;
@@ -65,12 +128,37 @@ operator()(propertiest &properties)
 
   run_property_decider(result, properties, solver_runtime);
 
+  if(solver_result_cache && !has_properties_to_check(properties))
+    solver_result_cache->store(properties);
+
   return result;
 }
 
 std::chrono::duration<double>
 multi_path_symex_checkert::prepare_property_decider(propertiest &properties)
 {
+  // The worker processes are forked before the assertions are converted,
+  // such that each of them only converts those of its own properties; the
+  // assertions and goals are then converted by
+  // run_property_decider_in_parallel.
+  if(options.is_set("parallel-properties") && !decided_in_parallel)
+  {
+    auto solver_start = std::chrono::steady_clock::now();
+
+    messaget log(ui_message_handler);
+    log.status()
+      << "Passing problem to "
+      << property_decider.get_decision_procedure().decision_procedure_text()
+      << messaget::eom;
+    log.status() << "converting SSA" << messaget::eom;
+
+    equation.convert_without_assertions(
+      property_decider.get_decision_procedure());
+
+    auto solver_stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(solver_stop - solver_start);
+  }
+
   std::chrono::duration<double> solver_runtime = ::prepare_property_decider(
     properties, equation, property_decider, ui_message_handler);
 
@@ -82,6 +170,79 @@ void multi_path_symex_checkert::run_property_decider(
   propertiest &properties,
   std::chrono::duration<double> solver_runtime)
 {
+  if(
+    !decided_in_parallel && (options.is_set("parallel-properties") ||
+                             options.is_set("cube-and-conquer")))
+  {
+    decided_in_parallel = true;
+
+    auto parallel_start = std::chrono::steady_clock::now();
+    if(options.is_set("cube-and-conquer"))
+    {
+      failing_cubes = run_cube_and_conquer(
+        result,
+        properties,
+        property_decider,
+        options.get_unsigned_int_option("cube-and-conquer"),
+        ui_message_handler);
+    }
+    else
+    {
+      run_property_decider_in_parallel(
+        result,
+        properties,
+        property_decider,
+        options.get_unsigned_int_option("parallel-properties"),
+        ui_message_handler);
+    }
+    auto parallel_stop = std::chrono::steady_clock::now();
+    solver_runtime +=
+      std::chrono::duration<double>(parallel_stop - parallel_start);
+
+    // the workers may have proved all properties
+    if(!has_properties_to_check(properties))
+    {
+      messaget log(ui_message_handler);
+      log.status() << "Runtime decision procedure: " << solver_runtime.count()
+                   << "s" << messaget::eom;
+      return;
+    }
+  }
+
+  // Search for the counterexamples of properties refuted by a worker within
+  // the cube the worker refuted them in. The result of this is
+  // inconclusive for the properties that do not fail, hence these are not
+  // set to PASS.
+  while(!failing_cubes.empty())
+  {
+    const failing_cubet &cube = failing_cubes.front();
+
+    const bool to_check = std::any_of(
+      cube.property_ids.begin(),
+      cube.property_ids.end(),
+      [&properties](const irep_idt &property_id) {
+        return is_property_to_check(properties.at(property_id).status);
+      });
+
+    if(to_check)
+    {
+      property_decider.get_stack_decision_procedure().push(cube.assumptions);
+      ::run_property_decider(
+        result,
+        properties,
+        property_decider,
+        ui_message_handler,
+        solver_runtime,
+        false);
+      property_decider.get_stack_decision_procedure().pop();
+
+      if(result.progress == resultt::progresst::FOUND_FAIL)
+        return;
+    }
+
+    failing_cubes.erase(failing_cubes.begin());
+  }
+
   ::run_property_decider(
     result, properties, property_decider, ui_message_handler, solver_runtime);
 }
@@ -13,11 +13,15 @@ Author: Daniel Kroening, Peter Schrammel
 #define CPROVER_GOTO_CHECKER_MULTI_PATH_SYMEX_CHECKER_H
 
 #include <chrono>
+#include <memory>
+#include <vector>
 
+#include "cube_and_conquer.h"
 #include "fault_localization_provider.h"
 #include "goto_symex_property_decider.h"
 #include "goto_trace_provider.h"
 #include "multi_path_symex_only_checker.h"
+#include "solver_result_cache.h"
 #include "witness_provider.h"
 
 /// Performs a multi-path symbolic execution using goto-symex
@@ -60,6 +64,19 @@ protected:
   bool equation_generated;
   goto_symex_property_decidert property_decider;
 
+  /// Whether the properties have already been partitioned among worker
+  /// processes (see `--parallel-properties` and `--cube-and-conquer`)
+  bool decided_in_parallel;
+
+  /// The cubes in which worker processes have refuted properties that the
+  /// solver has not yet found a counterexample for
+  /// (see `--cube-and-conquer`)
+  std::vector<failing_cubet> failing_cubes;
+
+  /// The results of previous runs on the same equation
+  /// (see `--solver-cache`)
+  std::unique_ptr<solver_result_cachet> solver_result_cache;
+
   /// Prepare the property decider for solving. This sets up the data structures
   /// for tracking goal literals, sets the status of \p properties to be checked
   /// to UNKNOWN and pushes the equation into the solver.
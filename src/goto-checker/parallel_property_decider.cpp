@@ -0,0 +1,221 @@
+/*******************************************************************\
+
+Module: Parallel Property Decider for Goto-Symex
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Parallel Property Decider for Goto-Symex
+
+#include "parallel_property_decider.h"
+
+#include <algorithm>
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+#include <util/exception_utils.h>
+#include <util/make_unique.h>
+#include <util/ui_message.h>
+#include <util/worker_process.h>
+
+#include "goto_symex_property_decider.h"
+
+/// Converts the assertions of the equation of \p property_decider that are
+/// not ignored, and the goals for those of \p properties that are still to
+/// be checked
+static void convert_assertions_and_goals(
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider)
+{
+  property_decider.get_equation().convert_assertions(
+    property_decider.get_decision_procedure());
+  property_decider.update_properties_goals_from_symex_target_equation(
+    properties);
+  property_decider.convert_goals();
+}
+
+/// Runs in the worker process: converts the assertions of the properties in
+/// \p partition and decides these properties
+/// \return one line per property decided, consisting of `P` or `F`
+///   followed by the property ID
+static std::string decide_partition(
+  const std::vector<irep_idt> &partition,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider)
+{
+  const std::unordered_set<irep_idt> in_partition(
+    partition.begin(), partition.end());
+
+  // This is the worker's private copy of the properties. We park the
+  // properties of the other partitions as FAIL: such properties are neither
+  // selected as goals nor updated by the solver result.
+  for(auto &property_pair : properties)
+  {
+    if(
+      is_property_to_check(property_pair.second.status) &&
+      in_partition.count(property_pair.first) == 0)
+    {
+      property_pair.second.status |= property_statust::FAIL;
+    }
+  }
+
+  // Likewise, the assertions of the other partitions are ignored in the
+  // worker's copy of the equation, such that they are not converted.
+  for(auto &step : property_decider.get_equation().SSA_steps)
+  {
+    if(step.is_assert() && in_partition.count(step.get_property_id()) == 0)
+      step.ignore = true;
+  }
+
+  convert_assertions_and_goals(properties, property_decider);
+
+  std::unordered_set<irep_idt> updated_properties;
+  decision_proceduret::resultt dec_result;
+
+  do
+  {
+    property_decider.add_constraint_from_goals(
+      [&properties](const irep_idt &property_id) {
+        return is_property_to_check(properties.at(property_id).status);
+      });
+
+    dec_result = property_decider.solve();
+
+    property_decider.update_properties_status_from_goals(
+      properties, updated_properties, dec_result);
+  } while(dec_result == decision_proceduret::resultt::D_SATISFIABLE &&
+          has_properties_to_check(properties));
+
+  std::ostringstream out;
+  for(const auto &property_id : partition)
+  {
+    const property_statust status = properties.at(property_id).status;
+    if(status == property_statust::PASS)
+      out << "P " << property_id << '\n';
+    else if(status == property_statust::FAIL)
+      out << "F " << property_id << '\n';
+  }
+
+  return out.str();
+}
+
+void run_property_decider_in_parallel(
+  incremental_goto_checkert::resultt &result,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider,
+  std::size_t number_of_workers,
+  ui_message_handlert &ui_message_handler)
+{
+  messaget log(ui_message_handler);
+
+  if(!worker_processt::is_supported())
+  {
+    log.warning() << "parallel property checking is not supported on this "
+                  << "platform" << messaget::eom;
+    convert_assertions_and_goals(properties, property_decider);
+    return;
+  }
+
+  std::vector<irep_idt> properties_to_check;
+  for(const auto &property_pair : properties)
+  {
+    if(is_property_to_check(property_pair.second.status))
+      properties_to_check.push_back(property_pair.first);
+  }
+
+  if(properties_to_check.size() < 2 || number_of_workers < 2)
+  {
+    convert_assertions_and_goals(properties, property_decider);
+    return;
+  }
+
+  // make the partitioning independent of the hash map's iteration order
+  std::sort(
+    properties_to_check.begin(),
+    properties_to_check.end(),
+    [](const irep_idt &a, const irep_idt &b) {
+      return id2string(a) < id2string(b);
+    });
+
+  number_of_workers = std::min(number_of_workers, properties_to_check.size());
+
+  std::vector<std::vector<irep_idt>> partitions(number_of_workers);
+  for(std::size_t i = 0; i < properties_to_check.size(); ++i)
+    partitions[i % number_of_workers].push_back(properties_to_check[i]);
+
+  log.status() << "Deciding " << properties_to_check.size()
+               << " properties using " << number_of_workers
+               << " worker processes" << messaget::eom;
+
+  std::vector<std::unique_ptr<worker_processt>> workers;
+
+  for(const auto &partition : partitions)
+  {
+    try
+    {
+      workers.push_back(util_make_unique<worker_processt>([&]() {
+        // keep the solver in the worker quiet
+        ui_message_handler.set_verbosity(messaget::M_ERROR);
+        return decide_partition(partition, properties, property_decider);
+      }));
+    }
+    catch(const system_exceptiont &e)
+    {
+      log.warning() << e.what() << messaget::eom;
+      break;
+    }
+  }
+
+  // While the workers solve, complete the formula of this process, which
+  // decides what the workers leave open and provides the models that
+  // counterexample traces are built from.
+  convert_assertions_and_goals(properties, property_decider);
+
+  std::size_t proved = 0;
+  std::size_t refuted = 0;
+
+  // merge the results in the order in which the workers finish
+  while(const auto ready = wait_for_any_worker(workers))
+  {
+    const auto output = workers[*ready]->wait();
+    workers[*ready] = nullptr;
+
+    if(!output.has_value())
+    {
+      log.warning() << "worker process failed, its properties are checked "
+                    << "sequentially" << messaget::eom;
+      continue;
+    }
+
+    std::istringstream in(*output);
+    std::string line;
+    while(std::getline(in, line))
+    {
+      if(line.size() < 3)
+        continue;
+
+      // Refuted properties are left to the caller, which needs a model
+      // of its own solver to build the counterexample trace.
+      if(line[0] == 'F')
+      {
+        ++refuted;
+        continue;
+      }
+
+      const irep_idt property_id = line.substr(2);
+      auto &property_status = properties.at(property_id).status;
+      if(is_property_to_check(property_status))
+      {
+        property_status |= property_statust::PASS;
+        result.updated_properties.insert(property_id);
+        ++proved;
+      }
+    }
+  }
+
+  log.statistics() << "Worker processes proved " << proved << " and refuted "
+                   << refuted << " properties" << messaget::eom;
+}
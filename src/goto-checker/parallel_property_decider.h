@@ -0,0 +1,53 @@
+/*******************************************************************\
+
+Module: Parallel Property Decider for Goto-Symex
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Parallel Property Decider for Goto-Symex
+
+#ifndef CPROVER_GOTO_CHECKER_PARALLEL_PROPERTY_DECIDER_H
+#define CPROVER_GOTO_CHECKER_PARALLEL_PROPERTY_DECIDER_H
+
+#include "incremental_goto_checker.h"
+#include "properties.h"
+
+class goto_symex_property_decidert;
+class ui_message_handlert;
+
+/// Partitions the properties that are still to be checked among
+/// \p number_of_workers worker processes. Each worker is forked after the
+/// equation apart from its assertions has been passed to the solver of
+/// \p property_decider, and hence starts from a copy of that formula. A
+/// worker converts only the assertions of the properties in its partition
+/// and then repeatedly solves for these properties until all of them are
+/// decided. Meanwhile, the calling process converts all assertions and the
+/// goals of \p property_decider.
+///
+/// Properties that a worker proves are set to PASS in \p properties and
+/// added to `result.updated_properties`. Properties that a worker refutes,
+/// or cannot decide, remain to be checked: the caller must still solve for
+/// them with \p property_decider, which then also provides the model that
+/// counterexample traces are built from.
+///
+/// On platforms without worker processes (see \ref worker_processt) this
+/// does nothing besides emitting a warning.
+/// \param [in,out] result: For recording the updated properties
+/// \param [in,out] properties: The status of proven properties is set to PASS
+/// \param [in,out] property_decider: A property decider whose equation has
+///   been converted without its assertions (see
+///   `symex_target_equationt::convert_without_assertions`), and that is
+///   fully prepared on return
+/// \param number_of_workers: The maximum number of worker processes
+/// \param [in,out] ui_message_handler: For logging
+void run_property_decider_in_parallel(
+  incremental_goto_checkert::resultt &result,
+  propertiest &properties,
+  goto_symex_property_decidert &property_decider,
+  std::size_t number_of_workers,
+  ui_message_handlert &ui_message_handler);
+
+#endif // CPROVER_GOTO_CHECKER_PARALLEL_PROPERTY_DECIDER_H
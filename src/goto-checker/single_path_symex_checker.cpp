@@ -11,6 +11,11 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "single_path_symex_checker.h"
 
+#include <sstream>
+
+#include <util/exception_utils.h>
+#include <util/make_unique.h>
+
 #include "bmc_util.h"
 #include "counterexample_beautification.h"
 #include "symex_bmc.h"
@@ -26,6 +31,34 @@ single_path_symex_checkert::single_path_symex_checkert(
 incremental_goto_checkert::resultt single_path_symex_checkert::
 operator()(propertiest &properties)
 {
+  if(options.is_set("parallel-paths") && !symex_initialized)
+  {
+    const unsigned number_of_workers =
+      options.get_unsigned_int_option("parallel-paths");
+
+    if(!worker_processt::is_supported())
+    {
+      log.warning() << "parallel path exploration is not supported on this "
+                    << "platform" << messaget::eom;
+    }
+    else if(number_of_workers > 1)
+    {
+      // this process counts as one of the workers
+      std::unique_ptr<worker_slotst> slots;
+      try
+      {
+        slots = util_make_unique<worker_slotst>(number_of_workers - 1);
+      }
+      catch(const system_exceptiont &e)
+      {
+        log.warning() << e.what() << messaget::eom;
+      }
+
+      if(slots)
+        return explore_paths_in_parallel(properties, *slots);
+    }
+  }
+
   resultt result(resultt::progresst::DONE);
 
   // There might be more solutions from the previous equation.
@@ -82,6 +115,178 @@ operator()(propertiest &properties)
   return result;
 }
 
+incremental_goto_checkert::resultt
+single_path_symex_checkert::explore_paths_in_parallel(
+  propertiest &properties,
+  worker_slotst &slots)
+{
+  resultt result(resultt::progresst::DONE);
+
+  symex_initialized = true;
+  initialize_worklist();
+
+  workerst workers;
+  explore_sharing_work(properties, result.updated_properties, slots, workers);
+  merge_worker_results(workers, properties, result.updated_properties, true);
+
+  final_update_properties(properties, result.updated_properties);
+
+  return result;
+}
+
+void single_path_symex_checkert::explore_sharing_work(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties,
+  worker_slotst &slots,
+  workerst &workers)
+{
+  while(!has_finished_exploration(properties))
+  {
+    merge_worker_results(workers, properties, updated_properties, false);
+
+    // Hand over the path that we would explore last, which is the root of
+    // the largest subtree with depth-first exploration, whenever a slot is
+    // free and there is work left for ourselves.
+    if(worklist->size() > 1 && slots.try_acquire())
+    {
+      try
+      {
+        workers.push_back(
+          util_make_unique<worker_processt>([this, &properties, &slots]() {
+            return explore_delegated_path(properties, slots);
+          }));
+        worklist->pop_last();
+        continue;
+      }
+      catch(const system_exceptiont &e)
+      {
+        slots.release();
+        log.warning() << e.what() << messaget::eom;
+      }
+    }
+
+    decide_next_path(properties, updated_properties);
+    worklist->pop();
+  }
+}
+
+void single_path_symex_checkert::decide_next_path(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  path_storaget::patht &path = worklist->peek();
+  if(!resume_path(path))
+    return;
+
+  update_properties(properties, updated_properties, path.equation);
+
+  property_decider = util_make_unique<goto_symex_property_decidert>(
+    options, ui_message_handler, path.equation, ns);
+
+  auto solver_runtime =
+    prepare_property_decider(properties, path.equation, *property_decider);
+
+  // No traces are built, hence we can look for all violations right away.
+  resultt result(resultt::progresst::FOUND_FAIL);
+  while(result.progress == resultt::progresst::FOUND_FAIL &&
+        has_properties_to_check(properties))
+  {
+    result.progress = resultt::progresst::DONE;
+    run_property_decider(result, properties, *property_decider, solver_runtime);
+    solver_runtime = std::chrono::duration<double>(0);
+  }
+
+  updated_properties.insert(
+    result.updated_properties.begin(), result.updated_properties.end());
+}
+
+std::string single_path_symex_checkert::explore_delegated_path(
+  propertiest &properties,
+  worker_slotst &slots)
+{
+  // keep symex and the solver in the worker quiet
+  ui_message_handler.set_verbosity(messaget::M_ERROR);
+
+  // We only explore the subtree below the path handed over to us;
+  // the other paths are explored by our parent.
+  path_storaget::patht path(worklist->peek_last());
+  worklist->clear();
+  worklist->push(path);
+
+  std::unordered_set<irep_idt> updated_properties;
+  workerst workers;
+  explore_sharing_work(properties, updated_properties, slots, workers);
+
+  // We are idle from now on: let another process use our slot while we
+  // wait for the workers we have started ourselves.
+  slots.release();
+  merge_worker_results(workers, properties, updated_properties, true);
+
+  std::ostringstream out;
+  for(const auto &property_id : updated_properties)
+  {
+    const property_statust status = properties.at(property_id).status;
+    if(status == property_statust::FAIL)
+      out << "F " << property_id << '\n';
+    else if(status == property_statust::ERROR)
+      out << "E " << property_id << '\n';
+  }
+
+  return out.str();
+}
+
+void single_path_symex_checkert::merge_worker_results(
+  workerst &workers,
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties,
+  bool wait_for_all)
+{
+  for(auto it = workers.begin(); it != workers.end();)
+  {
+    if(!wait_for_all && !(*it)->ready())
+    {
+      ++it;
+      continue;
+    }
+
+    const auto output = (*it)->wait();
+    it = workers.erase(it);
+
+    if(!output.has_value())
+    {
+      // We have lost the paths explored by this worker, hence we cannot
+      // claim anything about the properties that are still to be checked.
+      log.error() << "worker process failed" << messaget::eom;
+      for(auto &property_pair : properties)
+      {
+        if(is_property_to_check(property_pair.second.status))
+        {
+          property_pair.second.status |= property_statust::ERROR;
+          updated_properties.insert(property_pair.first);
+        }
+      }
+      continue;
+    }
+
+    std::istringstream in(*output);
+    std::string line;
+    while(std::getline(in, line))
+    {
+      if(line.size() < 3)
+        continue;
+
+      const irep_idt property_id = line.substr(2);
+      auto &status = properties.at(property_id).status;
+      if(is_property_to_check(status))
+      {
+        status |=
+          line[0] == 'F' ? property_statust::FAIL : property_statust::ERROR;
+        updated_properties.insert(property_id);
+      }
+    }
+  }
+}
+
 bool single_path_symex_checkert::is_ready_to_decide(
   const symex_bmct &symex,
   const path_storaget::patht &)
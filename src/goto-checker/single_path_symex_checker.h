@@ -15,6 +15,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <chrono>
 
 #include <util/optional.h>
+#include <util/worker_process.h>
 
 #include "goto_symex_property_decider.h"
 #include "goto_trace_provider.h"
@@ -72,6 +73,56 @@ protected:
     propertiest &properties,
     goto_symex_property_decidert &property_decider,
     std::chrono::duration<double> solver_runtime);
+
+  using workerst = std::vector<std::unique_ptr<worker_processt>>;
+
+  /// Explores all paths using this process and workers started whenever
+  /// one of the \p slots is free, see \ref explore_sharing_work.
+  /// Since counterexample traces cannot be passed back from the workers,
+  /// this returns only after all paths have been explored, with all
+  /// violated properties set to FAIL.
+  resultt
+  explore_paths_in_parallel(propertiest &properties, worker_slotst &slots);
+
+  /// Explores the paths in the worklist and all paths branching off them.
+  /// Whenever one of the \p slots is free and the worklist holds more than
+  /// one path, the path that would be explored last is handed over to a new
+  /// worker process, which is added to \p workers and explores its subtree
+  /// in the same way. Hence, any process that has work left shares it as
+  /// soon as another process has become idle, at any depth of the tree of
+  /// processes. Workers never pass paths back to the process that started
+  /// them, though, as the symex state cannot be transferred between
+  /// processes.
+  void explore_sharing_work(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties,
+    worker_slotst &slots,
+    workerst &workers);
+
+  /// Resumes the next path in the worklist and, if it is ready to be
+  /// decided, finds all property violations on that path
+  void decide_next_path(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties);
+
+  /// Runs in a worker process: explores the path that would be explored
+  /// last in the worklist and all paths branching off it, sharing work
+  /// using \p slots. Releases the slot of this worker when its own
+  /// paths have been explored.
+  /// \return one line per violated property, consisting of `F` (or `E` in
+  ///   case of an error) followed by the property ID, including those
+  ///   reported by the workers it has started
+  std::string
+  explore_delegated_path(propertiest &properties, worker_slotst &slots);
+
+  /// Merges the results of \p workers into \p properties and removes them
+  /// from \p workers. If \p wait_for_all is false, only those workers are
+  /// considered that have finished already.
+  void merge_worker_results(
+    workerst &workers,
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties,
+    bool wait_for_all);
 };
 
 #endif // CPROVER_GOTO_CHECKER_SINGLE_PATH_SYMEX_CHECKER_H
@@ -11,6 +11,7 @@ Author: Daniel Kroening, Peter Schrammel
 
 #include "solver_factory.h"
 
+#include <algorithm>
 #include <iostream>
 
 #include <util/exception_utils.h>
@@ -18,6 +19,7 @@ Author: Daniel Kroening, Peter Schrammel
 #include <util/message.h>
 #include <util/namespace.h>
 #include <util/options.h>
+#include <util/string_utils.h>
 #include <util/version.h>
 
 #ifdef _MSC_VER
@@ -31,10 +33,26 @@ Author: Daniel Kroening, Peter Schrammel
 #include <solvers/prop/prop_conv.h>
 #include <solvers/prop/solver_resource_limits.h>
 #include <solvers/refinement/bv_refinement.h>
+#include <solvers/sat/binary_cnf.h>
 #include <solvers/sat/dimacs_cnf.h>
 #include <solvers/sat/satcheck.h>
+#include <solvers/sat/satcheck_portfolio.h>
+#include <solvers/sat/satcheck_preprocessor.h>
 #include <solvers/strings/string_refinement.h>
 
+#ifdef HAVE_MINISAT2
+#include <solvers/sat/satcheck_minisat2.h>
+#endif
+#ifdef HAVE_GLUCOSE
+#include <solvers/sat/satcheck_glucose.h>
+#endif
+#ifdef HAVE_CADICAL
+#include <solvers/sat/satcheck_cadical.h>
+#endif
+#ifdef HAVE_IPASIR
+#include <solvers/sat/satcheck_ipasir.h>
+#endif
+
 solver_factoryt::solver_factoryt(
   const optionst &_options,
   const namespacet &_ns,
@@ -178,6 +196,8 @@ static std::unique_ptr<SatcheckT>
 make_satcheck_prop(message_handlert &message_handler, const optionst &options)
 {
   auto satcheck = util_make_unique<SatcheckT>(message_handler);
+  satcheck->set_structural_hashing(
+    options.get_bool_option("structural-hashing"));
   if(options.is_set("write-solver-stats-to"))
   {
     satcheck->enable_hardness_collection();
@@ -188,10 +208,108 @@ make_satcheck_prop(message_handlert &message_handler, const optionst &options)
   return satcheck;
 }
 
+template <typename SatcheckT>
+static satcheck_portfoliot::solver_configt make_portfolio_entry(
+  const std::string &name)
+{
+  return {name, [](message_handlert &message_handler) {
+            return std::unique_ptr<cnft>(
+              util_make_unique<SatcheckT>(message_handler));
+          }};
+}
+
+std::unique_ptr<propt> solver_factoryt::make_portfolio_prop()
+{
+  std::vector<satcheck_portfoliot::solver_configt> available;
+
+#ifdef HAVE_MINISAT2
+  available.push_back(
+    make_portfolio_entry<satcheck_minisat_simplifiert>("minisat2"));
+  available.push_back(
+    make_portfolio_entry<satcheck_minisat_no_simplifiert>(
+      "minisat2-no-simplifier"));
+#endif
+#ifdef HAVE_GLUCOSE
+  available.push_back(
+    make_portfolio_entry<satcheck_glucose_simplifiert>("glucose"));
+  available.push_back(
+    make_portfolio_entry<satcheck_glucose_no_simplifiert>(
+      "glucose-no-simplifier"));
+#endif
+#ifdef HAVE_CADICAL
+  available.push_back(make_portfolio_entry<satcheck_cadicalt>("cadical"));
+#endif
+#ifdef HAVE_IPASIR
+  available.push_back(make_portfolio_entry<satcheck_ipasirt>("ipasir"));
+#endif
+
+  std::string available_names;
+  for(const auto &entry : available)
+  {
+    if(!available_names.empty())
+      available_names += ", ";
+    available_names += entry.name;
+  }
+
+  std::vector<satcheck_portfoliot::solver_configt> solvers;
+
+  const auto names =
+    split_string(options.get_option("portfolio"), ',', true, true);
+
+  for(const auto &name : names)
+  {
+    const auto entry = std::find_if(
+      available.begin(),
+      available.end(),
+      [&name](const satcheck_portfoliot::solver_configt &entry) {
+        return entry.name == name;
+      });
+
+    if(entry == available.end())
+    {
+      throw invalid_command_line_argument_exceptiont(
+        "unknown or unavailable SAT solver '" + name + "'",
+        "--portfolio",
+        "available solvers are: " + available_names);
+    }
+
+    solvers.push_back(*entry);
+  }
+
+  if(solvers.empty())
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "no SAT solver given", "--portfolio", "e.g., " + available_names);
+  }
+
+  auto portfolio = util_make_unique<satcheck_portfoliot>(
+    std::move(solvers), message_handler);
+  portfolio->set_structural_hashing(
+    options.get_bool_option("structural-hashing"));
+  return std::move(portfolio);
+}
+
 std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_default()
 {
   auto solver = util_make_unique<solvert>();
-  if(
+  if(options.is_set("portfolio"))
+  {
+    solver->set_prop(make_portfolio_prop());
+  }
+  else if(options.get_bool_option("cnf-preprocessor"))
+  {
+    // the preprocessor takes the place of the simplifier of the SAT solver
+    auto satcheck = util_make_unique<satcheck_preprocessort>(
+      [](message_handlert &message_handler) {
+        return std::unique_ptr<cnft>(
+          util_make_unique<satcheck_no_simplifiert>(message_handler));
+      },
+      message_handler);
+    satcheck->set_structural_hashing(
+      options.get_bool_option("structural-hashing"));
+    solver->set_prop(std::move(satcheck));
+  }
+  else if(
     options.get_bool_option("beautify") ||
     !options.get_bool_option("sat-preprocessor")) // no simplifier
   {
@@ -223,13 +341,59 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_dimacs()
   no_beautification();
   no_incremental_check();
 
-  auto prop = util_make_unique<dimacs_cnft>(message_handler);
-
   std::string filename = options.get_option("outfile");
 
+  const bool binary = options.get_bool_option("binary-cnf");
+
+  if(binary && (filename.empty() || filename == "-"))
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "required filename not provided",
+      "--outfile",
+      "provide a filename with --outfile when using --binary-cnf");
+  }
+
+  if(filename.empty() || filename == "-")
+  {
+    auto prop = util_make_unique<dimacs_cnft>(message_handler);
+    prop->set_structural_hashing(
+      options.get_bool_option("structural-hashing"));
+
+    auto bv_dimacs =
+      util_make_unique<bv_dimacst>(ns, *prop, message_handler, filename);
+    return util_make_unique<solvert>(std::move(bv_dimacs), std::move(prop));
+  }
+
+  // Files are written while the clauses are generated, which saves keeping
+  // them in memory; the counts in the problem line are filled in at the end.
+  const auto mode = binary ? std::ios::out | std::ios::binary : std::ios::out;
+#ifdef _MSC_VER
+  auto out = util_make_unique<std::ofstream>(widen(filename), mode);
+#else
+  auto out = util_make_unique<std::ofstream>(filename, mode);
+#endif
+
+  if(!*out)
+  {
+    throw invalid_command_line_argument_exceptiont(
+      "failed to open file: " + filename, "--outfile");
+  }
+
+  std::unique_ptr<cnft> prop;
+  if(binary)
+    prop = util_make_unique<binary_cnf_writert>(*out, message_handler);
+  else
+    prop = util_make_unique<dimacs_cnf_streamt>(*out, message_handler);
+  prop->set_structural_hashing(options.get_bool_option("structural-hashing"));
+
   auto bv_dimacs =
     util_make_unique<bv_dimacst>(ns, *prop, message_handler, filename);
-  return util_make_unique<solvert>(std::move(bv_dimacs), std::move(prop));
+
+  auto solver = util_make_unique<solvert>();
+  solver->set_ofstream(std::move(out));
+  solver->set_prop(std::move(prop));
+  solver->set_decision_procedure(std::move(bv_dimacs));
+  return solver;
 }
 
 std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_bv_refinement()
@@ -257,6 +421,11 @@ std::unique_ptr<solver_factoryt::solvert> solver_factoryt::get_bv_refinement()
 
   info.refine_arrays = options.get_bool_option("refine-arrays");
   info.refine_arithmetic = options.get_bool_option("refine-arithmetic");
+  if(options.is_set("refine-arithmetic-width"))
+  {
+    info.min_arithmetic_width =
+      options.get_unsigned_int_option("refine-arithmetic-width");
+  }
   info.message_handler = &message_handler;
 
   auto decision_procedure = util_make_unique<bv_refinementt>(info);
@@ -319,6 +488,8 @@ solver_factoryt::get_smt2(smt2_dect::solvert solver)
     if(options.get_bool_option("fpa"))
       smt2_dec->use_FPA_theory = true;
 
+    smt2_dec->interactive = options.get_bool_option("smt2-interactive");
+
     smt2_dec->set_message_handler(message_handler);
 
     set_decision_procedure_time_limit(*smt2_dec);
@@ -78,6 +78,12 @@ protected:
 
   smt2_dect::solvert get_smt2_solver_type() const;
 
+  /// Returns a portfolio of the SAT solvers given in the comma-separated
+  /// `portfolio` option.
+  /// \throws invalid_command_line_argument_exceptiont if a solver is unknown
+  ///   or not available in this build
+  std::unique_ptr<propt> make_portfolio_prop();
+
   /// Sets the timeout of \p decision_procedure if the `solver-time-limit`
   /// option has a positive value (in seconds).
   /// \note Most solvers silently ignore the time limit at the moment.
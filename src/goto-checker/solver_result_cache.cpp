@@ -0,0 +1,341 @@
+/*******************************************************************\
+
+Module: Persistent Cache of Solver Results
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Persistent Cache of Solver Results
+
+#include "solver_result_cache.h"
+
+#ifdef _WIN32
+#  include <process.h>
+#  define getpid _getpid
+#else
+#  include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <unordered_map>
+#include <vector>
+
+#include <util/exception_utils.h>
+#include <util/file_util.h>
+#include <util/namespace.h>
+#include <util/options.h>
+#include <util/sha256.h>
+#include <util/version.h>
+
+#include <goto-symex/symex_target_equation.h>
+
+/// First line of every cache file
+static const char cache_file_header[] = "CBMC solver result cache 2";
+
+/// Options that configure the decision procedure, see `solver_factoryt`
+static const char *const solver_option_names[] = {
+  "arrays-uf",
+  "boolector",
+  "cprover-smt2",
+  "cvc3",
+  "cvc4",
+  "fpa",
+  "generic",
+  "mathsat",
+  "max-node-refinement",
+  "refine",
+  "refine-arithmetic",
+  "refine-arithmetic-width",
+  "refine-arrays",
+  "refine-strings",
+  "sat-preprocessor",
+  "smt2",
+  "yices",
+  "z3",
+};
+
+/// SHA-256 digest of ireps that only depends on the contents of the
+/// strings, not on their numbering in the string container. The digest of
+/// a node covers the digests of its operands, so that shared subtrees are
+/// only digested once.
+class stable_irep_digestt
+{
+public:
+  explicit stable_irep_digestt(const namespacet &ns) : ns(ns)
+  {
+  }
+
+  static void add(sha256t &sha256, const std::string &s)
+  {
+    add(sha256, s.size());
+    sha256.update(s);
+  }
+
+  static void add(sha256t &sha256, std::uint64_t value)
+  {
+    unsigned char bytes[8];
+    for(int i = 0; i < 8; ++i, value >>= 8)
+      bytes[i] = static_cast<unsigned char>(value & 0xff);
+    sha256.update(bytes, sizeof(bytes));
+  }
+
+  /// \return the 32 bytes of the digest of \p irep
+  const std::string &operator()(const irept &irep);
+
+protected:
+  const namespacet &ns;
+
+  /// Digests of the tree nodes already visited: the equation shares most of
+  /// its subexpressions, which must not be digested more than once
+  std::unordered_map<const void *, std::string> node_digests;
+  std::unordered_map<irep_idt, std::string> tag_digests;
+
+  const std::string &tag_digest(const irep_idt &identifier);
+};
+
+const std::string &stable_irep_digestt::operator()(const irept &irep)
+{
+  const void *node = &irep.read();
+  const auto entry = node_digests.find(node);
+  if(entry != node_digests.end())
+    return entry->second;
+
+  sha256t sha256;
+  add(sha256, irep.id_string());
+
+  add(sha256, irep.get_sub().size());
+  for(const auto &sub : irep.get_sub())
+    sha256.update((*this)(sub));
+
+  // order by contents, not by string number
+  std::vector<std::pair<std::string, const irept *>> named_sub;
+  for(const auto &entry : irep.get_named_sub())
+  {
+    if(!irept::is_comment(entry.first))
+      named_sub.emplace_back(id2string(entry.first), &entry.second);
+  }
+  std::sort(
+    named_sub.begin(),
+    named_sub.end(),
+    [](
+      const std::pair<std::string, const irept *> &a,
+      const std::pair<std::string, const irept *> &b) {
+      return a.first < b.first;
+    });
+
+  add(sha256, named_sub.size());
+  for(const auto &entry : named_sub)
+  {
+    add(sha256, entry.first);
+    sha256.update((*this)(*entry.second));
+  }
+
+  // the definitions of tag types are used by the decision procedure
+  if(
+    irep.id() == ID_struct_tag || irep.id() == ID_union_tag ||
+    irep.id() == ID_c_enum_tag)
+  {
+    sha256.update(tag_digest(irep.get(ID_identifier)));
+  }
+
+  return node_digests.emplace(node, sha256.digest()).first->second;
+}
+
+const std::string &stable_irep_digestt::tag_digest(const irep_idt &identifier)
+{
+  const auto entry = tag_digests.find(identifier);
+  if(entry != tag_digests.end())
+    return entry->second;
+
+  // recursive types refer to themselves by their name only
+  sha256t name_sha256;
+  add(name_sha256, id2string(identifier));
+  tag_digests.emplace(identifier, name_sha256.digest());
+
+  sha256t sha256;
+  add(sha256, id2string(identifier));
+  const symbolt *symbol;
+  if(!ns.lookup(identifier, symbol))
+    sha256.update((*this)(symbol->type));
+
+  std::string &digest = tag_digests[identifier];
+  digest = sha256.digest();
+  return digest;
+}
+
+optionalt<std::string> solver_result_cache_build_id()
+{
+  // The version is completed by `git describe --tags --always --dirty` when
+  // building, which names the tag or the abbreviated hash of the commit.
+  // Builds of modified or unknown sources cannot be told apart.
+  const std::string version = CBMC_VERSION;
+  if(
+    version.find("(n/a)") != std::string::npos ||
+    version.find("-dirty)") != std::string::npos ||
+    version.find('(') == std::string::npos)
+  {
+    return {};
+  }
+
+  return version;
+}
+
+std::string solver_result_cache_key(
+  const symex_target_equationt &equation,
+  const optionst &options,
+  const namespacet &ns)
+{
+  stable_irep_digestt digest(ns);
+  sha256t sha256;
+
+  stable_irep_digestt::add(sha256, CBMC_VERSION);
+
+  for(const auto name : solver_option_names)
+  {
+    stable_irep_digestt::add(sha256, name);
+    stable_irep_digestt::add(sha256, options.get_option(name));
+  }
+
+  for(const auto &step : equation.SSA_steps)
+  {
+    // sliced steps are not passed to the decision procedure
+    if(step.ignore)
+      continue;
+
+    stable_irep_digestt::add(sha256, static_cast<std::uint64_t>(step.type));
+    sha256.update(digest(step.guard));
+    sha256.update(digest(step.ssa_lhs));
+    sha256.update(digest(step.ssa_rhs));
+    sha256.update(digest(step.cond_expr));
+    stable_irep_digestt::add(sha256, id2string(step.called_function));
+    stable_irep_digestt::add(sha256, step.atomic_section_id);
+
+    stable_irep_digestt::add(sha256, step.ssa_function_arguments.size());
+    for(const auto &argument : step.ssa_function_arguments)
+      sha256.update(digest(argument));
+
+    stable_irep_digestt::add(sha256, step.io_args.size());
+    for(const auto &argument : step.io_args)
+      sha256.update(digest(argument));
+
+    if(step.is_assert())
+      stable_irep_digestt::add(sha256, id2string(step.get_property_id()));
+  }
+
+  return sha256t::to_hex(sha256.digest());
+}
+
+solver_result_cachet::solver_result_cachet(
+  std::string directory,
+  const symex_target_equationt &equation,
+  const optionst &options,
+  const namespacet &ns,
+  message_handlert &message_handler)
+  : directory(std::move(directory)),
+    key(solver_result_cache_key(equation, options, ns)),
+    log(message_handler)
+{
+  log.debug() << "Solver result cache key: " << key << messaget::eom;
+}
+
+std::string solver_result_cachet::get_file_name() const
+{
+  return concat_dir_file(directory, key + ".cache");
+}
+
+std::size_t solver_result_cachet::lookup(
+  propertiest &properties,
+  std::unordered_set<irep_idt> &updated_properties)
+{
+  std::ifstream in(get_file_name());
+  if(!in)
+    return 0;
+
+  std::string line;
+  if(!std::getline(in, line) || line != cache_file_header)
+  {
+    log.warning() << "ignoring invalid solver result cache file "
+                  << get_file_name() << messaget::eom;
+    return 0;
+  }
+
+  std::size_t proved = 0;
+
+  while(std::getline(in, line))
+  {
+    // refuted properties are solved for again to obtain a trace
+    if(line.compare(0, 5, "PASS ") != 0)
+      continue;
+
+    const auto property_it = properties.find(line.substr(5));
+    if(
+      property_it != properties.end() &&
+      is_property_to_check(property_it->second.status))
+    {
+      property_it->second.status |= property_statust::PASS;
+      updated_properties.insert(property_it->first);
+      ++proved;
+    }
+  }
+
+  log.status() << "Solver result cache: " << proved
+               << " properties proved in a previous run" << messaget::eom;
+
+  return proved;
+}
+
+void solver_result_cachet::store(const propertiest &properties)
+{
+  if(!is_directory(directory) && !create_directory(directory))
+  {
+    log.warning() << "failed to create solver result cache directory "
+                  << directory << messaget::eom;
+    return;
+  }
+
+  // sort for reproducible cache files
+  std::vector<std::string> lines;
+  for(const auto &property_pair : properties)
+  {
+    if(property_pair.second.status == property_statust::PASS)
+      lines.push_back("PASS " + id2string(property_pair.first));
+    else if(property_pair.second.status == property_statust::FAIL)
+      lines.push_back("FAIL " + id2string(property_pair.first));
+  }
+  std::sort(lines.begin(), lines.end());
+
+  // write to a temporary file first: another process may read the cache
+  // file concurrently; the name of the temporary file is unique to this
+  // process as others may write the same cache file at the same time
+  const std::string file_name = get_file_name();
+  const std::string temporary_file_name =
+    file_name + "." + std::to_string(getpid()) + ".tmp";
+
+  {
+    std::ofstream out(temporary_file_name);
+    out << cache_file_header << '\n';
+    for(const auto &line : lines)
+      out << line << '\n';
+
+    if(!out)
+    {
+      log.warning() << "failed to write solver result cache file "
+                    << temporary_file_name << messaget::eom;
+      return;
+    }
+  }
+
+  try
+  {
+    file_rename(temporary_file_name, file_name);
+  }
+  catch(const system_exceptiont &e)
+  {
+    log.warning() << "failed to write solver result cache file " << file_name
+                  << ": " << e.what() << messaget::eom;
+  }
+}
@@ -0,0 +1,93 @@
+/*******************************************************************\
+
+Module: Persistent Cache of Solver Results
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Persistent Cache of Solver Results
+
+#ifndef CPROVER_GOTO_CHECKER_SOLVER_RESULT_CACHE_H
+#define CPROVER_GOTO_CHECKER_SOLVER_RESULT_CACHE_H
+
+#include <unordered_set>
+
+#include <util/message.h>
+#include <util/optional.h>
+
+#include "properties.h"
+
+class namespacet;
+class optionst;
+class symex_target_equationt;
+
+/// Results are only reused by the same build of the tool, as a different
+/// build may differ in the encoding or in the decision procedure.
+/// \return the version of the tool including the git revision it has been
+///   built from, or an empty optional if the build is not identified by a
+///   git revision, as it has been built from modified sources or outside a
+///   git working copy
+optionalt<std::string> solver_result_cache_build_id();
+
+/// Computes a SHA-256 digest of the parts of \p equation that are passed to
+/// the decision procedure, of the options that configure the decision
+/// procedure and of the version of the tool, see
+/// `solver_result_cache_build_id`. Unlike `irept::hash`, the result does not
+/// depend on the order in which strings have been interned, and is hence
+/// stable across runs. Tag types are followed using \p ns, as their
+/// definitions are used by the decision procedure.
+/// \return the digest as hexadecimal string
+std::string solver_result_cache_key(
+  const symex_target_equationt &equation,
+  const optionst &options,
+  const namespacet &ns);
+
+/// A directory of files that record the status of properties, with one file
+/// per equation. The file name is derived from `solver_result_cache_key`,
+/// so that checking the same equation with the same solver configuration
+/// again can reuse the results of the previous run.
+///
+/// Only proved properties are taken from the cache: refuted properties
+/// still need to be solved for, as the counterexample trace is built from
+/// the model of the decision procedure.
+class solver_result_cachet
+{
+public:
+  /// Computes the cache key of \p equation, see `solver_result_cache_key`
+  solver_result_cachet(
+    std::string directory,
+    const symex_target_equationt &equation,
+    const optionst &options,
+    const namespacet &ns,
+    message_handlert &message_handler);
+
+  /// Sets the status of those \p properties that are still to be checked
+  /// and that have been proved in a previous run to PASS
+  /// \param [in,out] properties: The properties to look up
+  /// \param [out] updated_properties: The IDs of properties set to PASS are
+  ///   added to this set
+  /// \return the number of properties that have been set to PASS
+  std::size_t lookup(
+    propertiest &properties,
+    std::unordered_set<irep_idt> &updated_properties);
+
+  /// Records the status of the decided \p properties. Failing to write the
+  /// cache file is not an error, but is reported as a warning.
+  void store(const propertiest &properties);
+
+  const std::string &get_key() const
+  {
+    return key;
+  }
+
+protected:
+  std::string directory;
+  std::string key;
+  messaget log;
+
+  std::string get_file_name() const;
+};
+
+#endif // CPROVER_GOTO_CHECKER_SOLVER_RESULT_CACHE_H
@@ -0,0 +1,144 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking for ANSI-C
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Symbolic execution that unwinds all loops incrementally
+
+#include "symex_bmc_incremental_unwind.h"
+
+#include <util/make_unique.h>
+
+symex_bmc_incremental_unwindt::symex_bmc_incremental_unwindt(
+  message_handlert &message_handler,
+  const symbol_tablet &outer_symbol_table,
+  symex_target_equationt &target,
+  const optionst &options,
+  path_storaget &path_storage,
+  guard_managert &guard_manager)
+  : symex_bmct(
+      message_handler,
+      outer_symbol_table,
+      target,
+      options,
+      path_storage,
+      guard_manager)
+{
+}
+
+void symex_bmc_incremental_unwindt::set_unwind_bound(unsigned unwind)
+{
+  unwind_bound = unwind;
+  unwindset.parse_unwind(std::to_string(unwind));
+}
+
+bool symex_bmc_incremental_unwindt::from_entry_point_of(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table,
+  unsigned unwind)
+{
+  set_unwind_bound(unwind);
+  checkpoint = nullptr;
+
+  auto state = initialize_entry_point_state(get_goto_function);
+  symex_with_state(*state, get_goto_function, new_symbol_table);
+
+  return checkpoint != nullptr;
+}
+
+bool symex_bmc_incremental_unwindt::resume(
+  const get_goto_functiont &get_goto_function,
+  symbol_tablet &new_symbol_table,
+  unsigned unwind)
+{
+  PRECONDITION(checkpoint != nullptr);
+  PRECONDITION(unwind > unwind_bound);
+
+  set_unwind_bound(unwind);
+  const auto resumed = std::move(checkpoint);
+
+  target = resumed->equation;
+  resume_symex_from_saved_state(
+    get_goto_function, resumed->state, &target, new_symbol_table);
+
+  return checkpoint != nullptr;
+}
+
+void symex_bmc_incremental_unwindt::symex_goto(statet &state)
+{
+  instruction_state = &state;
+  instruction_equation_size = target.SSA_steps.size();
+
+  symex_bmct::symex_goto(state);
+
+  instruction_state = nullptr;
+}
+
+void symex_bmc_incremental_unwindt::symex_function_call(
+  const get_goto_functiont &get_goto_function,
+  statet &state,
+  const code_function_callt &code)
+{
+  instruction_state = &state;
+  instruction_equation_size = target.SSA_steps.size();
+
+  symex_bmct::symex_function_call(get_goto_function, state, code);
+
+  instruction_state = nullptr;
+}
+
+bool symex_bmc_incremental_unwindt::save_checkpoint()
+{
+  if(checkpoint != nullptr || instruction_state == nullptr)
+    return false;
+
+  checkpoint =
+    util_make_unique<path_storaget::patht>(target, *instruction_state);
+
+  // the instruction is executed again when resuming
+  auto &steps = checkpoint->equation.SSA_steps;
+  steps.erase(std::next(steps.begin(), instruction_equation_size), steps.end());
+  --checkpoint->state.depth;
+
+  return true;
+}
+
+bool symex_bmc_incremental_unwindt::should_stop_unwind(
+  const symex_targett::sourcet &source,
+  const call_stackt &context,
+  unsigned unwind)
+{
+  const bool abort = symex_bmct::should_stop_unwind(source, context, unwind);
+
+  const irep_idt id = goto_programt::loop_id(source.function_id, *source.pc);
+  const auto limit = unwindset.get_limit(id, source.thread_nr);
+
+  // loops with a limit of their own are unwound the same with any bound
+  if(abort && limit.has_value() && *limit == unwind_bound && save_checkpoint())
+  {
+    // the unwinding has been counted by symex_goto already
+    --checkpoint->state.call_stack().top().loop_iterations[id].count;
+  }
+
+  return abort;
+}
+
+bool symex_bmc_incremental_unwindt::get_unwind_recursion(
+  const irep_idt &identifier,
+  unsigned thread_nr,
+  unsigned unwind)
+{
+  const bool abort =
+    symex_bmct::get_unwind_recursion(identifier, thread_nr, unwind);
+
+  const auto limit = unwindset.get_limit(identifier, thread_nr);
+
+  if(abort && limit.has_value() && *limit == unwind_bound)
+    save_checkpoint();
+
+  return abort;
+}
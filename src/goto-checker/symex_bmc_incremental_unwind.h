@@ -0,0 +1,91 @@
+/*******************************************************************\
+
+Module: Incremental Bounded Model Checking for ANSI-C
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Symbolic execution that unwinds all loops incrementally
+
+#ifndef CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+#define CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
+
+#include "symex_bmc.h"
+
+#include <goto-symex/path_storage.h>
+
+/// Symbolic execution that unwinds the loops and recursions without a limit
+/// of their own (see `--unwindset`) up to a global bound that can be
+/// increased between runs.
+///
+/// When the first loop or recursion exceeds the bound, a copy of the state
+/// and the equation as they were before executing the backward GOTO or the
+/// function call is kept as a checkpoint. Up to that point, symbolic
+/// execution with a greater bound does exactly the same, hence it is
+/// resumed from the checkpoint rather than from the entry point.
+class symex_bmc_incremental_unwindt : public symex_bmct
+{
+public:
+  symex_bmc_incremental_unwindt(
+    message_handlert &,
+    const symbol_tablet &outer_symbol_table,
+    symex_target_equationt &,
+    const optionst &,
+    path_storaget &,
+    guard_managert &);
+
+  /// Executes the program from the entry point with global bound \p unwind
+  /// \return true if a loop or recursion has exceeded the bound
+  bool from_entry_point_of(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table,
+    unsigned unwind);
+
+  /// Executes the program from the checkpoint of the previous run, which
+  /// replaces the equation, with the greater global bound \p unwind
+  /// \return true if a loop or recursion has exceeded the bound
+  bool resume(
+    const get_goto_functiont &get_goto_function,
+    symbol_tablet &new_symbol_table,
+    unsigned unwind);
+
+protected:
+  unsigned unwind_bound = 0;
+
+  /// The state and equation before the first loop or recursion that
+  /// exceeded the bound in the current run
+  std::unique_ptr<path_storaget::patht> checkpoint;
+
+  /// The state executing a GOTO or function call, if any, and the number of
+  /// SSA steps before it
+  statet *instruction_state = nullptr;
+  std::size_t instruction_equation_size = 0;
+
+  void set_unwind_bound(unsigned unwind);
+
+  void symex_goto(statet &state) override;
+
+  void symex_function_call(
+    const get_goto_functiont &get_goto_function,
+    statet &state,
+    const code_function_callt &code) override;
+
+  bool should_stop_unwind(
+    const symex_targett::sourcet &source,
+    const call_stackt &context,
+    unsigned unwind) override;
+
+  bool get_unwind_recursion(
+    const irep_idt &identifier,
+    unsigned thread_nr,
+    unsigned unwind) override;
+
+  /// Keeps a copy of the state and the equation before the current
+  /// instruction, unless there is a checkpoint already
+  /// \return true if a checkpoint has been saved
+  bool save_checkpoint();
+};
+
+#endif // CPROVER_GOTO_CHECKER_SYMEX_BMC_INCREMENTAL_UNWIND_H
@@ -50,6 +50,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-programs/validate_goto_model.h>
 #include <goto-programs/write_goto_binary.h>
 
+#include <linking/static_lifetime_init.h>
+
 #include <pointer-analysis/add_failed_symbols.h>
 #include <pointer-analysis/goto_program_dereference.h>
 #include <pointer-analysis/show_value_sets.h>
@@ -982,7 +984,17 @@ void goto_instrument_parse_optionst::get_goto_program()
 
   config.set(cmdline);
 
-  auto result = read_goto_binary(cmdline.args[0], ui_message_handler);
+  std::vector<irep_idt> entry_points;
+  if(cmdline.isset("lazy-goto-binary"))
+  {
+    // a binary built with goto-cc -c has no entry point yet
+    entry_points = {goto_functionst::entry_point(),
+                    config.main.value_or("main"),
+                    INITIALIZE_FUNCTION};
+  }
+
+  auto result =
+    read_goto_binary(cmdline.args[0], entry_points, ui_message_handler);
 
   if(!result.has_value())
     throw 0;
@@ -1769,6 +1781,8 @@ void goto_instrument_parse_optionst::help()
     HELP_SHOW_GOTO_FUNCTIONS
     HELP_GOTO_PROGRAM_STATS
     " --drop-unused-functions      drop functions trivially unreachable from main function\n" // NOLINT(*)
+    " --lazy-goto-binary           only read functions that may be reachable\n"
+    "                              from the entry point\n"
     " --print-internal-representation\n" // NOLINTNEXTLINE(*)
     "                              show verbose internal representation of the program\n"
     " --list-undefined-functions   list functions without body\n"
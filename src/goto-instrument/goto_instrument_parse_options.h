@@ -73,6 +73,7 @@ Author: Daniel Kroening, kroening@kroening.com
   OPT_SHOW_GOTO_FUNCTIONS \
   OPT_SHOW_PROPERTIES \
   "(drop-unused-functions)" \
+  "(lazy-goto-binary)" \
   "(show-value-sets)" \
   "(show-global-may-alias)" \
   "(show-local-bitvector-analysis)(show-custom-bitvector-analysis)" \
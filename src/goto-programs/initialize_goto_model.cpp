@@ -24,6 +24,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <langapi/language_file.h>
 #include <langapi/mode.h>
 
+#include <linking/static_lifetime_init.h>
+
 #include <goto-programs/rebuild_goto_start_function.h>
 #include <util/exception_utils.h>
 
@@ -134,11 +136,38 @@ goto_modelt initialize_goto_model(
     }
   }
 
+  // Only read the functions that may be reachable from the entry point.
+  // This requires a single goto binary, as a function may be called from
+  // another file than the one it is defined in.
+  std::vector<irep_idt> entry_points;
+  if(options.get_bool_option("lazy-goto-binary"))
+  {
+    if(binaries.size() == 1 && sources.empty())
+    {
+      // a given entry function replaces the existing entry point
+      if(options.is_set("function"))
+        entry_points.push_back(options.get_option("function"));
+      else
+      {
+        entry_points.push_back(goto_functionst::entry_point());
+        // a binary built with goto-cc -c has no entry point: the one that
+        // is generated below calls the main function
+        entry_points.push_back(config.main.value_or("main"));
+      }
+      entry_points.push_back(INITIALIZE_FUNCTION);
+    }
+    else
+    {
+      msg.warning() << "--lazy-goto-binary requires a single goto binary "
+                    << "as input; reading all functions" << messaget::eom;
+    }
+  }
+
   for(const auto &file : binaries)
   {
     msg.status() << "Reading GOTO program from file" << messaget::eom;
 
-    if(read_object_and_link(file, goto_model, message_handler))
+    if(read_object_and_link(file, goto_model, entry_points, message_handler))
     {
       throw invalid_source_file_exceptiont(
         "failed to read object or link in file '" + file + '\'');
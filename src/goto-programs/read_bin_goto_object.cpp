@@ -13,6 +13,12 @@ Date: June 2006
 
 #include "read_bin_goto_object.h"
 
+#include <streambuf>
+#include <unordered_map>
+#include <vector>
+
+#include <util/exception_utils.h>
+#include <util/find_symbols.h>
 #include <util/namespace.h>
 #include <util/message.h>
 #include <util/symbol_table.h>
@@ -21,14 +27,125 @@ Date: June 2006
 #include "goto_functions.h"
 #include "write_goto_binary.h"
 
+/// A read-only stream buffer over memory owned by the caller, which saves
+/// copying a function body into a string stream before decoding it
+class memory_streambuft : public std::streambuf
+{
+public:
+  memory_streambuft(const char *data, std::size_t size)
+  {
+    char *begin = const_cast<char *>(data);
+    setg(begin, begin, begin + size);
+  }
+};
+
+/// Reads the instructions of function \p f
+/// \return true if the function is to be hidden
+static bool read_goto_function(
+  std::istream &in,
+  goto_functionst::goto_functiont &f,
+  irep_serializationt &irepconverter)
+{
+  typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
+  target_mapt target_map;
+  typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
+  rev_target_mapt rev_target_map;
+
+  bool hidden=false;
+
+  std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
+  for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
+  {
+    goto_programt::targett itarget = f.body.add_instruction();
+    goto_programt::instructiont &instruction=*itarget;
+
+    instruction.code =
+      static_cast<const codet &>(irepconverter.reference_convert(in));
+    instruction.source_location = static_cast<const source_locationt &>(
+      irepconverter.reference_convert(in));
+    instruction.type = (goto_program_instruction_typet)
+                            irepconverter.read_gb_word(in);
+    instruction.guard =
+      static_cast<const exprt &>(irepconverter.reference_convert(in));
+    instruction.target_number = irepconverter.read_gb_word(in);
+    if(instruction.is_target() &&
+       rev_target_map.insert(
+         rev_target_map.end(),
+         std::make_pair(instruction.target_number, itarget))->second!=itarget)
+      UNREACHABLE;
+
+    std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
+    for(std::size_t i=0; i<t_count; i++)
+      // just save the target numbers
+      target_map[itarget].push_back(irepconverter.read_gb_word(in));
+
+    std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
+
+    for(std::size_t i=0; i<l_count; i++)
+    {
+      irep_idt label=irepconverter.read_string_ref(in);
+      instruction.labels.push_back(label);
+      if(label == CPROVER_PREFIX "HIDE")
+        hidden=true;
+      // The above info is normally in the type of the goto_functiont object,
+      // which should likely be stored in the binary.
+    }
+  }
+
+  // Resolve targets
+  for(target_mapt::iterator tit = target_map.begin();
+      tit!=target_map.end();
+      tit++)
+  {
+    goto_programt::targett ins = tit->first;
+
+    for(std::list<unsigned>::iterator nit = tit->second.begin();
+        nit!=tit->second.end();
+        nit++)
+    {
+      unsigned n=*nit;
+      rev_target_mapt::const_iterator entry=rev_target_map.find(n);
+      INVARIANT(
+        entry != rev_target_map.end(),
+        "something from the target map should also be in the reverse target "
+        "map");
+      ins->targets.push_back(entry->second);
+    }
+  }
+
+  f.body.update();
+
+  return hidden;
+}
+
+/// Decodes a function body of a version 6 goto binary, which uses ireps and
+/// strings of its own
+static void decode_goto_function(
+  const std::string &data,
+  goto_functionst::goto_functiont &f)
+{
+  memory_streambuft buffer(data.data(), data.size());
+  std::istream in(&buffer);
+  irep_serializationt::ireps_containert irepc;
+  irep_serializationt irepconverter(irepc);
+
+  if(read_goto_function(in, f, irepconverter))
+    f.make_hidden();
+}
+
 /// read goto binary format
-/// \par parameters: input stream, symbol_table, functions
+/// \par parameters: input stream, symbol_table, functions, the version of
+///   the goto binary format, the functions to start reading from (all
+///   functions are read if empty), message handler
 /// \return true on error, false otherwise
 static bool read_bin_goto_object(
   std::istream &in,
   symbol_tablet &symbol_table,
   goto_functionst &functions,
-  irep_serializationt &irepconverter)
+  irep_serializationt &irepconverter,
+  std::size_t version,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &message_handler)
 {
   std::size_t count = irepconverter.read_gb_word(in); // # of symbols
 
@@ -85,90 +202,85 @@ static bool read_bin_goto_object(
 
   count=irepconverter.read_gb_word(in); // # of functions
 
+  // the undecoded bodies of functions, when reading lazily
+  std::unordered_map<irep_idt, std::string> function_bodies;
+  std::string function_data;
+
   for(std::size_t fct_index = 0; fct_index < count; ++fct_index)
   {
     irep_idt fname=irepconverter.read_gb_string(in);
-    goto_functionst::goto_functiont &f = functions.function_map[fname];
-
-    typedef std::map<goto_programt::targett, std::list<unsigned> > target_mapt;
-    target_mapt target_map;
-    typedef std::map<unsigned, goto_programt::targett> rev_target_mapt;
-    rev_target_mapt rev_target_map;
-
-    bool hidden=false;
 
-    std::size_t ins_count = irepconverter.read_gb_word(in); // # of instructions
-    for(std::size_t ins_index = 0; ins_index < ins_count; ++ins_index)
+    if(version == 5)
     {
-      goto_programt::targett itarget = f.body.add_instruction();
-      goto_programt::instructiont &instruction=*itarget;
-
-      instruction.code =
-        static_cast<const codet &>(irepconverter.reference_convert(in));
-      instruction.source_location = static_cast<const source_locationt &>(
-        irepconverter.reference_convert(in));
-      instruction.type = (goto_program_instruction_typet)
-                              irepconverter.read_gb_word(in);
-      instruction.guard =
-        static_cast<const exprt &>(irepconverter.reference_convert(in));
-      instruction.target_number = irepconverter.read_gb_word(in);
-      if(instruction.is_target() &&
-         rev_target_map.insert(
-           rev_target_map.end(),
-           std::make_pair(instruction.target_number, itarget))->second!=itarget)
-        UNREACHABLE;
-
-      std::size_t t_count = irepconverter.read_gb_word(in); // # of targets
-      for(std::size_t i=0; i<t_count; i++)
-        // just save the target numbers
-        target_map[itarget].push_back(irepconverter.read_gb_word(in));
-
-      std::size_t l_count = irepconverter.read_gb_word(in); // # of labels
-
-      for(std::size_t i=0; i<l_count; i++)
+      goto_functionst::goto_functiont &f = functions.function_map[fname];
+      if(read_goto_function(in, f, irepconverter))
       {
-        irep_idt label=irepconverter.read_string_ref(in);
-        instruction.labels.push_back(label);
-        if(label == CPROVER_PREFIX "HIDE")
-          hidden=true;
-        // The above info is normally in the type of the goto_functiont object,
-        // which should likely be stored in the binary.
+        f.make_hidden();
+        symbol_table.get_writeable_ref(fname).set_hidden();
       }
+      continue;
     }
 
-    // Resolve targets
-    for(target_mapt::iterator tit = target_map.begin();
-        tit!=target_map.end();
-        tit++)
-    {
-      goto_programt::targett ins = tit->first;
+    // The function body is self-contained: read it in one go, and decode
+    // it now or once it is known to be reachable.
+    const std::size_t size = irepconverter.read_gb_word(in);
+    function_data.resize(size);
+    if(!in.read(&function_data[0], size))
+      throw deserialization_exceptiont("unexpected end of input stream");
 
-      for(std::list<unsigned>::iterator nit = tit->second.begin();
-          nit!=tit->second.end();
-          nit++)
-      {
-        unsigned n=*nit;
-        rev_target_mapt::const_iterator entry=rev_target_map.find(n);
-        INVARIANT(
-          entry != rev_target_map.end(),
-          "something from the target map should also be in the reverse target "
-          "map");
-        ins->targets.push_back(entry->second);
-      }
+    if(entry_points.empty())
+      decode_goto_function(function_data, functions.function_map[fname]);
+    else
+      function_bodies[fname].swap(function_data);
+  }
+
+  if(!function_bodies.empty())
+  {
+    const std::size_t number_of_bodies = function_bodies.size();
+
+    // Function pointers may point to any function whose address is taken,
+    // which includes those in initializers of variables.
+    find_symbols_sett referenced;
+    for(const auto &symbol_pair : symbol_table.symbols)
+    {
+      if(!symbol_pair.second.is_type && symbol_pair.second.type.id() != ID_code)
+        find_symbols_or_nexts(symbol_pair.second.value, referenced);
     }
 
-    f.body.update();
+    std::vector<irep_idt> worklist(entry_points);
+    worklist.insert(worklist.end(), referenced.begin(), referenced.end());
 
-    if(hidden)
+    while(!worklist.empty())
     {
-      f.make_hidden();
-      // can be removed with the next goto-binary version update as the
-      // information is guaranteed to be stored in the symbol table
-#if GOTO_BINARY_VERSION > 5
-#error This code should be removed
-#endif
-      symbol_table.get_writeable_ref(fname).set_hidden();
+      const irep_idt fname = worklist.back();
+      worklist.pop_back();
+
+      const auto body_it = function_bodies.find(fname);
+      if(body_it == function_bodies.end())
+        continue;
+
+      goto_functionst::goto_functiont &f = functions.function_map[fname];
+      decode_goto_function(body_it->second, f);
+      function_bodies.erase(body_it);
+
+      // all functions that are called, or whose address is taken
+      referenced.clear();
+      for(const auto &instruction : f.body.instructions)
+      {
+        find_symbols_or_nexts(instruction.code, referenced);
+        find_symbols_or_nexts(instruction.guard, referenced);
+      }
+
+      for(const auto &identifier : referenced)
+      {
+        if(function_bodies.count(identifier) != 0)
+          worklist.push_back(identifier);
+      }
     }
+
+    messaget(message_handler).statistics()
+      << "Read " << number_of_bodies - function_bodies.size() << " of "
+      << number_of_bodies << " function bodies" << messaget::eom;
   }
 
   functions.compute_location_numbers();
@@ -185,6 +297,18 @@ bool read_bin_goto_object(
   symbol_tablet &symbol_table,
   goto_functionst &functions,
   message_handlert &message_handler)
+{
+  return read_bin_goto_object(
+    in, filename, symbol_table, functions, {}, message_handler);
+}
+
+bool read_bin_goto_object(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &functions,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &message_handler)
 {
   messaget message(message_handler);
 
@@ -232,16 +356,23 @@ bool read_bin_goto_object(
   {
     std::size_t version=irepconverter.read_gb_word(in);
 
-    if(version < GOTO_BINARY_VERSION)
+    if(version < 5)
     {
       message.error() <<
           "The input was compiled with an old version of "
           "goto-cc; please recompile" << messaget::eom;
       return true;
     }
-    else if(version == GOTO_BINARY_VERSION)
+    else if(version <= GOTO_BINARY_VERSION)
     {
-      return read_bin_goto_object(in, symbol_table, functions, irepconverter);
+      return read_bin_goto_object(
+        in,
+        symbol_table,
+        functions,
+        irepconverter,
+        version,
+        entry_points,
+        message_handler);
     }
     else
     {
@@ -16,6 +16,9 @@ Date: May 2007
 
 #include <iosfwd>
 #include <string>
+#include <vector>
+
+#include <util/irep.h>
 
 class symbol_tablet;
 class goto_functionst;
@@ -28,4 +31,18 @@ bool read_bin_goto_object(
   goto_functionst &goto_functions,
   message_handlert &message_handler);
 
+/// Reads a goto binary, but only decodes the bodies of the functions that may
+/// be reachable from \p entry_points, i.e., that are called or whose address
+/// is taken in a function that is decoded, or in the initial value of a
+/// variable. The other functions are left without body. This is only
+/// supported by goto binaries of version 6 or later: all functions are read
+/// from older binaries, and when \p entry_points is empty.
+bool read_bin_goto_object(
+  std::istream &in,
+  const std::string &filename,
+  symbol_tablet &symbol_table,
+  goto_functionst &goto_functions,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &message_handler);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_BIN_GOTO_OBJECT_H
@@ -30,6 +30,7 @@ static bool read_goto_binary(
   const std::string &filename,
   symbol_tablet &,
   goto_functionst &,
+  const std::vector<irep_idt> &entry_points,
   message_handlert &);
 
 /// \brief Read a goto binary from a file, but do not update \ref config
@@ -38,11 +39,31 @@ static bool read_goto_binary(
 /// \return goto model on success, {} on failure
 optionalt<goto_modelt>
 read_goto_binary(const std::string &filename, message_handlert &message_handler)
+{
+  return read_goto_binary(filename, {}, message_handler);
+}
+
+/// \brief Read a goto binary from a file, but do not update \ref config.
+///   Only the bodies of functions that may be reachable from the given
+///   functions are read, see \ref read_bin_goto_object.
+/// \param filename: the file name of the goto binary
+/// \param entry_points: the functions to start from; all functions are read
+///   if empty
+/// \param message_handler: for diagnostics
+/// \return goto model on success, {} on failure
+optionalt<goto_modelt> read_goto_binary(
+  const std::string &filename,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &message_handler)
 {
   goto_modelt dest;
 
   if(read_goto_binary(
-       filename, dest.symbol_table, dest.goto_functions, message_handler))
+       filename,
+       dest.symbol_table,
+       dest.goto_functions,
+       entry_points,
+       message_handler))
   {
     return {};
   }
@@ -54,12 +75,15 @@ read_goto_binary(const std::string &filename, message_handlert &message_handler)
 /// \param filename: the file name of the goto binary
 /// \param symbol_table: the symbol table from the goto binary
 /// \param goto_functions: the goto functions from the goto binary
+/// \param entry_points: the functions to start reading from, see
+///   \ref read_bin_goto_object
 /// \param message_handler: for diagnostics
 /// \return true on failure, false on success
 static bool read_goto_binary(
   const std::string &filename,
   symbol_tablet &symbol_table,
   goto_functionst &goto_functions,
+  const std::vector<irep_idt> &entry_points,
   message_handlert &message_handler)
 {
   #ifdef _MSC_VER
@@ -90,7 +114,12 @@ static bool read_goto_binary(
   if(hdr[0]==0x7f && hdr[1]=='G' && hdr[2]=='B' && hdr[3]=='F')
   {
     return read_bin_goto_object(
-      in, filename, symbol_table, goto_functions, message_handler);
+      in,
+      filename,
+      symbol_table,
+      goto_functions,
+      entry_points,
+      message_handler);
   }
   else if(hdr[0]==0x7f && hdr[1]=='E' && hdr[2]=='L' && hdr[3]=='F')
   {
@@ -105,7 +134,12 @@ static bool read_goto_binary(
         {
           in.seekg(elf_reader.section_offset(i));
           return read_bin_goto_object(
-            in, filename, symbol_table, goto_functions, message_handler);
+            in,
+            filename,
+            symbol_table,
+            goto_functions,
+            entry_points,
+            message_handler);
         }
 
       // section not found
@@ -140,7 +174,12 @@ static bool read_goto_binary(
         message.error() << "failed to read temp binary" << messaget::eom;
 
       const bool read_err = read_bin_goto_object(
-        temp_in, filename, symbol_table, goto_functions, message_handler);
+        temp_in,
+        filename,
+        symbol_table,
+        goto_functions,
+        entry_points,
+        message_handler);
       temp_in.close();
 
       return read_err;
@@ -165,7 +204,12 @@ static bool read_goto_binary(
       {
         in.seekg(entry->second.offset);
         return read_bin_goto_object(
-          in, filename, symbol_table, goto_functions, message_handler);
+          in,
+          filename,
+          symbol_table,
+          goto_functions,
+          entry_points,
+          message_handler);
       }
 
       // section not found
@@ -274,12 +318,28 @@ bool read_object_and_link(
   const std::string &file_name,
   goto_modelt &dest,
   message_handlert &message_handler)
+{
+  return read_object_and_link(file_name, dest, {}, message_handler);
+}
+
+/// \brief reads an object file, and also updates config
+/// \param file_name: file name of the goto binary
+/// \param dest: the goto model returned
+/// \param entry_points: the functions to start reading from, see
+///   \ref read_bin_goto_object
+/// \param message_handler: for diagnostics
+/// \return true on error, false otherwise
+bool read_object_and_link(
+  const std::string &file_name,
+  goto_modelt &dest,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &message_handler)
 {
   messaget(message_handler).statistics() << "Reading: "
                                          << file_name << messaget::eom;
 
   // we read into a temporary model
-  auto temp_model = read_goto_binary(file_name, message_handler);
+  auto temp_model = read_goto_binary(file_name, entry_points, message_handler);
   if(!temp_model.has_value())
     return true;
 
@@ -13,8 +13,10 @@ Author: Daniel Kroening, kroening@kroening.com
 #define CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
 
 #include <string>
+#include <vector>
 
 #include <util/deprecate.h>
+#include <util/irep.h>
 #include <util/optional.h>
 
 class goto_functionst;
@@ -25,6 +27,11 @@ class symbol_tablet;
 optionalt<goto_modelt>
 read_goto_binary(const std::string &filename, message_handlert &);
 
+optionalt<goto_modelt> read_goto_binary(
+  const std::string &filename,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &);
+
 bool is_goto_binary(const std::string &filename, message_handlert &);
 
 bool read_object_and_link(
@@ -38,4 +45,10 @@ bool read_object_and_link(
   goto_modelt &,
   message_handlert &);
 
+bool read_object_and_link(
+  const std::string &file_name,
+  goto_modelt &,
+  const std::vector<irep_idt> &entry_points,
+  message_handlert &);
+
 #endif // CPROVER_GOTO_PROGRAMS_READ_GOTO_BINARY_H
@@ -12,6 +12,7 @@ Author: CM Wintersteiger
 #include "write_goto_binary.h"
 
 #include <fstream>
+#include <sstream>
 
 #include <util/exception_utils.h>
 #include <util/invariant.h>
@@ -21,12 +22,43 @@ Author: CM Wintersteiger
 
 #include <goto-programs/goto_model.h>
 
+/// Writes the instructions of \p function
+static void write_goto_function(
+  std::ostream &out,
+  const goto_functionst::goto_functiont &function,
+  irep_serializationt &irepconverter)
+{
+  write_gb_word(out, function.body.instructions.size()); // # instructions
+
+  forall_goto_program_instructions(i_it, function.body)
+  {
+    const goto_programt::instructiont &instruction = *i_it;
+
+    irepconverter.reference_convert(instruction.code, out);
+    irepconverter.reference_convert(instruction.source_location, out);
+    write_gb_word(out, (long)instruction.type);
+    irepconverter.reference_convert(instruction.guard, out);
+    write_gb_word(out, instruction.target_number);
+
+    write_gb_word(out, instruction.targets.size());
+
+    for(const auto &t_it : instruction.targets)
+      write_gb_word(out, t_it->target_number);
+
+    write_gb_word(out, instruction.labels.size());
+
+    for(const auto &l_it : instruction.labels)
+      irepconverter.write_string_ref(out, l_it);
+  }
+}
+
 /// Writes a goto program to disc, using goto binary format
-bool write_goto_binary(
+static bool write_goto_binary(
   std::ostream &out,
   const symbol_tablet &symbol_table,
   const goto_functionst &goto_functions,
-  irep_serializationt &irepconverter)
+  irep_serializationt &irepconverter,
+  int version)
 {
   // first write symbol table
 
@@ -84,35 +116,31 @@ bool write_goto_binary(
 
   for(const auto &fct : goto_functions.function_map)
   {
-    if(fct.second.body_available())
-    {
-      // Since version 2, goto functions are not converted to ireps,
-      // instead they are saved in a custom binary format
-
-      write_gb_string(out, id2string(fct.first)); // name
-      write_gb_word(out, fct.second.body.instructions.size()); // # instructions
+    if(!fct.second.body_available())
+      continue;
 
-      forall_goto_program_instructions(i_it, fct.second.body)
-      {
-        const goto_programt::instructiont &instruction = *i_it;
-
-        irepconverter.reference_convert(instruction.code, out);
-        irepconverter.reference_convert(instruction.source_location, out);
-        write_gb_word(out, (long)instruction.type);
-        irepconverter.reference_convert(instruction.guard, out);
-        write_gb_word(out, instruction.target_number);
-
-        write_gb_word(out, instruction.targets.size());
-
-        for(const auto &t_it : instruction.targets)
-          write_gb_word(out, t_it->target_number);
+    // Since version 2, goto functions are not converted to ireps,
+    // instead they are saved in a custom binary format
 
-        write_gb_word(out, instruction.labels.size());
+    write_gb_string(out, id2string(fct.first)); // name
 
-        for(const auto &l_it : instruction.labels)
-          irepconverter.write_string_ref(out, l_it);
-      }
+    if(version == 5)
+    {
+      write_goto_function(out, fct.second, irepconverter);
+      continue;
     }
+
+    // Since version 6, each function body is preceded by its size and
+    // does not refer to ireps or strings written before. Readers can thus
+    // skip the bodies of functions they do not need, or decode them later.
+    irep_serializationt::ireps_containert function_irepc;
+    irep_serializationt function_irepconverter(function_irepc);
+    std::ostringstream function_out;
+    write_goto_function(function_out, fct.second, function_irepconverter);
+
+    const std::string data = function_out.str();
+    write_gb_word(out, data.size());
+    out.write(data.data(), data.size());
   }
 
   // irepconverter.output_map(f);
@@ -148,16 +176,17 @@ bool write_goto_binary(
   irep_serializationt::ireps_containert irepc;
   irep_serializationt irepconverter(irepc);
 
-  if(version < GOTO_BINARY_VERSION)
+  if(version < 5)
     throw invalid_command_line_argument_exceptiont(
       "version " + std::to_string(version) + " no longer supported",
-      "supported version = " + std::to_string(GOTO_BINARY_VERSION));
+      "supported versions = 5, " + std::to_string(GOTO_BINARY_VERSION));
   else if(version > GOTO_BINARY_VERSION)
     throw invalid_command_line_argument_exceptiont(
       "unknown goto binary version " + std::to_string(version),
-      "supported version = " + std::to_string(GOTO_BINARY_VERSION));
+      "supported versions = 5, " + std::to_string(GOTO_BINARY_VERSION));
   else
-    return write_goto_binary(out, symbol_table, goto_functions, irepconverter);
+    return write_goto_binary(
+      out, symbol_table, goto_functions, irepconverter, version);
 }
 
 /// Writes a goto program to disc
@@ -12,7 +12,9 @@ Author: CM Wintersteiger
 #ifndef CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 #define CPROVER_GOTO_PROGRAMS_WRITE_GOTO_BINARY_H
 
-#define GOTO_BINARY_VERSION 5
+// Version 6 adds the size of each function body, see write_goto_binary.cpp.
+// Version 5 can still be read and written.
+#define GOTO_BINARY_VERSION 6
 
 #include <iosfwd>
 #include <string>
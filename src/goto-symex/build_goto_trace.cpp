@@ -342,7 +342,7 @@ void build_goto_trace(
       goto_trace_step.function_id = SSA_step.source.function_id;
       if(SSA_step.is_assert())
       {
-        goto_trace_step.comment = SSA_step.comment;
+        goto_trace_step.comment = id2string(SSA_step.comment);
         goto_trace_step.property_id = SSA_step.get_property_id();
       }
       goto_trace_step.type = SSA_step.type;
@@ -31,6 +31,9 @@ struct framet
   guardt guard_at_function_start;
   goto_programt::const_targett end_of_function;
   exprt return_value = nil_exprt();
+  /// Key under which the return value is recorded at the end of the
+  /// function, see \ref function_summariest, or nil
+  exprt summary_key = nil_exprt();
   bool hidden_function = false;
 
   symex_level1t old_level1;
@@ -0,0 +1,265 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Summaries of Function Calls
+
+#include "function_summaries.h"
+
+#include <util/expr_util.h>
+#include <util/find_symbols.h>
+#include <util/namespace.h>
+#include <util/std_code.h>
+
+#include <goto-programs/remove_returns.h>
+
+#include <algorithm>
+#include <map>
+#include <set>
+
+/// Determines the properties of a function that permit reusing the results
+/// of its calls, see \ref function_summariest
+static optionalt<function_summariest::summarisablet> analyse_function(
+  const irep_idt &identifier,
+  const goto_functionst::goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  using assignedt = std::set<irep_idt>;
+
+  if(!goto_function.body_available())
+    return {};
+
+  const irep_idt return_value = return_value_identifier(identifier);
+
+  // the objects that are private to a call
+  assignedt locals(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+  locals.insert(return_value);
+  for(const auto &instruction : goto_function.body.instructions)
+  {
+    if(instruction.is_decl())
+      locals.insert(instruction.get_decl().get_identifier());
+  }
+
+  std::set<irep_idt> read_globals;
+  function_summariest::summarisablet result;
+
+  // the locals assigned on all paths to the current instruction, and those
+  // assigned on all jumps to an instruction
+  assignedt assigned(
+    goto_function.parameter_identifiers.begin(),
+    goto_function.parameter_identifiers.end());
+  bool reachable = true;
+  std::map<goto_programt::const_targett, assignedt> assigned_at_target;
+
+  auto join = [](assignedt &dest, const assignedt &src) {
+    assignedt intersection;
+    std::set_intersection(
+      dest.begin(),
+      dest.end(),
+      src.begin(),
+      src.end(),
+      std::inserter(intersection, intersection.begin()));
+    dest.swap(intersection);
+  };
+
+  auto is_pure = [](const exprt &expr) {
+    return !has_subexpr(expr, [](const exprt &e) {
+      return e.id() == ID_dereference || e.id() == ID_address_of ||
+             e.id() == ID_side_effect || e.id() == ID_nondet_symbol;
+    });
+  };
+
+  auto can_read = [&](const exprt &expr) {
+    if(!is_pure(expr))
+      return false;
+
+    for(const auto &id : find_symbol_identifiers(expr))
+    {
+      if(locals.count(id) != 0)
+      {
+        if(assigned.count(id) == 0)
+          return false;
+        continue;
+      }
+
+      const symbolt *symbol;
+      if(ns.lookup(id, symbol))
+        return false;
+
+      if(symbol->type.id() == ID_code)
+        continue;
+
+      if(!symbol->is_static_lifetime)
+        return false;
+
+      read_globals.insert(id);
+    }
+
+    return true;
+  };
+
+  for(auto it = goto_function.body.instructions.begin();
+      it != goto_function.body.instructions.end();
+      ++it)
+  {
+    const auto jumps = assigned_at_target.find(it);
+    if(jumps != assigned_at_target.end())
+    {
+      if(reachable)
+        join(assigned, jumps->second);
+      else
+        assigned = jumps->second;
+      reachable = true;
+    }
+
+    if(!reachable)
+      continue;
+
+    switch(it->type)
+    {
+    case SKIP:
+    case LOCATION:
+      break;
+
+    case DECL:
+      assigned.erase(it->get_decl().get_identifier());
+      break;
+
+    case DEAD:
+      assigned.erase(it->get_dead().get_identifier());
+      break;
+
+    case ASSIGN:
+    {
+      const code_assignt &assign = it->get_assign();
+      if(!can_read(assign.rhs()))
+        return {};
+
+      // writes to parts of an object read the rest of it
+      exprt lhs = assign.lhs();
+      bool partial = false;
+      while(lhs.id() == ID_index || lhs.id() == ID_member)
+      {
+        partial = true;
+
+        if(lhs.id() == ID_member)
+        {
+          lhs = to_member_expr(lhs).compound();
+          continue;
+        }
+
+        if(!can_read(to_index_expr(lhs).index()))
+          return {};
+
+        lhs = to_index_expr(lhs).array();
+      }
+
+      if(lhs.id() != ID_symbol)
+        return {};
+
+      const irep_idt &lhs_id = to_symbol_expr(lhs).get_identifier();
+      if(locals.count(lhs_id) == 0 || (partial && !can_read(lhs)))
+        return {};
+
+      assigned.insert(lhs_id);
+      break;
+    }
+
+    case GOTO:
+      if(it->is_backwards_goto() || !can_read(it->get_condition()))
+        return {};
+
+      result.has_jumps = true;
+
+      for(const auto &target : it->targets)
+      {
+        const auto inserted = assigned_at_target.emplace(target, assigned);
+        if(!inserted.second)
+          join(inserted.first->second, assigned);
+      }
+
+      if(it->get_condition().is_true())
+        reachable = false;
+      break;
+
+    case END_FUNCTION:
+    {
+      // the return value would otherwise be that of an earlier call
+      const symbolt *symbol;
+      if(!ns.lookup(return_value, symbol) && assigned.count(return_value) == 0)
+        return {};
+      break;
+    }
+
+    case ASSERT:
+    case ASSUME:
+    case FUNCTION_CALL:
+    case RETURN:
+    case OTHER:
+    case START_THREAD:
+    case END_THREAD:
+    case ATOMIC_BEGIN:
+    case ATOMIC_END:
+    case THROW:
+    case CATCH:
+    case INCOMPLETE_GOTO:
+    case NO_INSTRUCTION_TYPE:
+      return {};
+    }
+  }
+
+  for(const auto &id : read_globals)
+    result.read_globals.push_back(ns.lookup(id).symbol_expr());
+
+  return std::move(result);
+}
+
+const optionalt<function_summariest::summarisablet> &
+function_summariest::summarisable(
+  const irep_idt &identifier,
+  const goto_functionst::goto_functiont &goto_function,
+  const namespacet &ns)
+{
+  auto entry = functions.find(identifier);
+  if(entry == functions.end())
+  {
+    entry =
+      functions
+        .emplace(identifier, analyse_function(identifier, goto_function, ns))
+        .first;
+  }
+
+  return entry->second;
+}
+
+exprt function_summariest::make_key(
+  const irep_idt &identifier,
+  exprt::operandst values)
+{
+  exprt key(identifier);
+  key.operands() = std::move(values);
+  return key;
+}
+
+const exprt *function_summariest::find(const exprt &key)
+{
+  const auto entry = summaries.find(key);
+  if(entry == summaries.end())
+    return nullptr;
+
+  ++hits;
+  return &entry->second;
+}
+
+void function_summariest::insert(exprt key, exprt return_value)
+{
+  if(summaries.emplace(std::move(key), std::move(return_value)).second)
+    ++recorded;
+}
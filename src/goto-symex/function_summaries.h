@@ -0,0 +1,92 @@
+/*******************************************************************\
+
+Module: Symbolic Execution
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Summaries of Function Calls
+
+#ifndef CPROVER_GOTO_SYMEX_FUNCTION_SUMMARIES_H
+#define CPROVER_GOTO_SYMEX_FUNCTION_SUMMARIES_H
+
+#include <util/optional.h>
+#include <util/std_expr.h>
+
+#include <goto-programs/goto_functions.h>
+
+#include <unordered_map>
+#include <vector>
+
+class namespacet;
+
+/// Records the return values of calls to functions whose effect is fully
+/// determined by the values of their arguments and of the global variables
+/// they read, such that symex can reuse the return value of an earlier call
+/// instead of executing the body of the function again.
+///
+/// A function qualifies if its body consists of declarations, assignments to
+/// its parameters, local variables and return value, and forward jumps only,
+/// does not dereference pointers, take addresses or have side effects, and
+/// assigns every local variable and its return value on all paths before
+/// they are read. In particular, it contains neither calls nor properties.
+///
+/// The return value is recorded after L2 renaming, i.e., it is a constant or
+/// refers to the SSA symbols defined by the call that was executed. As these
+/// definitions hold unconditionally, the value is valid at any later call
+/// with the same L2 arguments and values of the global variables read. The
+/// guard is only relevant for functions with jumps, where phi functions and
+/// pruned branches may depend on it.
+class function_summariest
+{
+public:
+  /// Properties of a function that permit reusing the results of its calls
+  struct summarisablet
+  {
+    /// The function contains jumps, hence its result may depend on the guard
+    bool has_jumps = false;
+
+    /// The global variables read by the function
+    std::vector<symbol_exprt> read_globals;
+  };
+
+  /// Determines whether the results of calls to \p identifier can be
+  /// reused, see \ref function_summariest. The result is cached.
+  /// \return the properties of the function, or an empty optional if its
+  ///   calls need to be executed
+  const optionalt<summarisablet> &summarisable(
+    const irep_idt &identifier,
+    const goto_functionst::goto_functiont &goto_function,
+    const namespacet &ns);
+
+  /// Builds the key of a call to \p identifier from the L2-renamed values
+  /// that determine its result
+  static exprt make_key(const irep_idt &identifier, exprt::operandst values);
+
+  /// \return the return value recorded for \p key, nil if the function does
+  ///   not return a value, or nullptr if no value has been recorded
+  const exprt *find(const exprt &key);
+
+  void insert(exprt key, exprt return_value);
+
+  /// Forgets all the recorded return values, which refer to the symbols of
+  /// the current state, but not whether functions are summarisable
+  void clear()
+  {
+    summaries.clear();
+  }
+
+  /// Number of calls whose execution has been avoided
+  std::size_t hits = 0;
+
+  /// Number of calls whose return value has been recorded
+  std::size_t recorded = 0;
+
+private:
+  std::unordered_map<irep_idt, optionalt<summarisablet>> functions;
+  std::unordered_map<exprt, exprt, irep_hash> summaries;
+};
+
+#endif // CPROVER_GOTO_SYMEX_FUNCTION_SUMMARIES_H
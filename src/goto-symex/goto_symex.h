@@ -14,10 +14,12 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <util/options.h>
 #include <util/message.h>
+#include <util/simplify_expr_cache.h>
 
 #include <goto-programs/abstract_goto_model.h>
 
 #include "complexity_limiter.h"
+#include "function_summaries.h"
 #include "path_storage.h"
 #include "symex_config.h"
 
@@ -78,7 +80,8 @@ public:
       path_segment_vccs(0),
       _total_vccs(std::numeric_limits<unsigned>::max()),
       _remaining_vccs(std::numeric_limits<unsigned>::max()),
-      complexity_module(mh, options)
+      complexity_module(mh, options),
+      simplify_cache(symex_config.simplify_cache_size)
   {
   }
 
@@ -821,6 +824,14 @@ protected:
 
   complexity_limitert complexity_module;
 
+  /// Results of simplification during the current run of
+  /// \ref symex_with_state, which all use \ref ns
+  simplify_expr_cachet simplify_cache;
+
+  /// Return values of function calls during the current run of
+  /// \ref symex_with_state
+  function_summariest function_summaries;
+
 public:
   unsigned get_total_vccs() const
   {
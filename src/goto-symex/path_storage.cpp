@@ -43,6 +43,18 @@ void path_lifot::private_pop()
   last_peeked = paths.end();
 }
 
+path_storaget::patht &path_lifot::private_peek_last()
+{
+  return paths.front();
+}
+
+void path_lifot::private_pop_last()
+{
+  if(last_peeked == paths.begin())
+    last_peeked = paths.end();
+  paths.pop_front();
+}
+
 std::size_t path_lifot::size() const
 {
   return paths.size();
@@ -71,6 +83,16 @@ void path_fifot::private_pop()
   paths.pop_front();
 }
 
+path_storaget::patht &path_fifot::private_peek_last()
+{
+  return paths.back();
+}
+
+void path_fifot::private_pop_last()
+{
+  paths.pop_back();
+}
+
 std::size_t path_fifot::size() const
 {
   return paths.size();
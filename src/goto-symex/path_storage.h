@@ -81,6 +81,20 @@ public:
     private_pop();
   }
 
+  /// \brief Reference to the path that would be resumed last
+  patht &peek_last()
+  {
+    PRECONDITION(!empty());
+    return private_peek_last();
+  }
+
+  /// \brief Remove the path that would be resumed last from the storage
+  void pop_last()
+  {
+    PRECONDITION(!empty());
+    private_pop_last();
+  }
+
   /// \brief How many paths does this storage contain?
   virtual std::size_t size() const = 0;
 
@@ -141,6 +155,8 @@ private:
   // enforce preconditions.
   virtual patht &private_peek() = 0;
   virtual void private_pop() = 0;
+  virtual patht &private_peek_last() = 0;
+  virtual void private_pop_last() = 0;
 
   typedef std::unordered_map<irep_idt, std::size_t> name_index_mapt;
 
@@ -177,6 +193,8 @@ protected:
 private:
   patht &private_peek() override;
   void private_pop() override;
+  patht &private_peek_last() override;
+  void private_pop_last() override;
 };
 
 /// \brief FIFO save queue: paths are resumed in the order that they were saved
@@ -193,6 +211,8 @@ protected:
 private:
   patht &private_peek() override;
   void private_pop() override;
+  patht &private_peek_last() override;
+  void private_pop_last() override;
 };
 
 /// \brief suitable for displaying as a front-end help message
@@ -0,0 +1,165 @@
+/*******************************************************************\
+
+Module: Word-Level Simplification of the Equation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Word-Level Simplification of the Equation
+
+#include "simplify_equation.h"
+
+#include <util/expr_util.h>
+#include <util/replace_symbol.h>
+#include <util/simplify_expr.h>
+#include <util/std_expr.h>
+
+#include "symex_target_equation.h"
+
+/// Returns true if \p expr is of the form `c ? k1 : k2` for constants k1, k2
+static bool is_constant_choice(const exprt &expr)
+{
+  if(expr.id() != ID_if)
+    return false;
+
+  const if_exprt &if_expr = to_if_expr(expr);
+  return if_expr.true_case().is_constant() &&
+         if_expr.false_case().is_constant();
+}
+
+/// Returns true if the definition of a symbol by \p rhs is cheap enough to
+/// be substituted into all uses of the symbol
+static bool is_propagated_definition(const exprt &rhs)
+{
+  if(rhs.is_constant() || rhs.id() == ID_symbol)
+    return true;
+
+  if(!is_constant_choice(rhs))
+    return false;
+
+  // the condition is duplicated, hence must be atomic
+  const exprt &cond = to_if_expr(rhs).cond();
+  return cond.id() == ID_symbol ||
+         (cond.id() == ID_not && to_not_expr(cond).op().id() == ID_symbol);
+}
+
+static bool is_liftable_operator(const irep_idt &id)
+{
+  return id == ID_equal || id == ID_notequal || id == ID_lt || id == ID_le ||
+         id == ID_gt || id == ID_ge || id == ID_plus || id == ID_minus ||
+         id == ID_mult || id == ID_div || id == ID_mod || id == ID_bitand ||
+         id == ID_bitor || id == ID_bitxor || id == ID_shl ||
+         id == ID_lshr || id == ID_ashr;
+}
+
+/// Rewrites `(c ? k1 : k2) op k` to `c ? (k1 op k) : (k2 op k)`, and
+/// likewise for a constant left operand
+/// \return true if \p expr has been changed
+static bool lift_constant_choices(exprt &expr)
+{
+  bool changed = false;
+
+  Forall_operands(it, expr)
+  {
+    if(lift_constant_choices(*it))
+      changed = true;
+  }
+
+  if(expr.operands().size() != 2 || !is_liftable_operator(expr.id()))
+    return changed;
+
+  for(std::size_t i = 0; i < 2; ++i)
+  {
+    const exprt &choice = expr.operands()[i];
+    const exprt &other = expr.operands()[1 - i];
+
+    if(!is_constant_choice(choice) || !other.is_constant())
+      continue;
+
+    const if_exprt if_expr = to_if_expr(choice);
+
+    exprt true_case = expr;
+    true_case.operands()[i] = if_expr.true_case();
+    exprt false_case = expr;
+    false_case.operands()[i] = if_expr.false_case();
+
+    expr = if_exprt(
+      if_expr.cond(), std::move(true_case), std::move(false_case), expr.type());
+    return true;
+  }
+
+  return changed;
+}
+
+/// Substitutes the definitions in \p replace into \p expr and simplifies it
+/// \return true if \p expr has been changed
+static bool rewrite(
+  exprt &expr,
+  const replace_symbolt &replace,
+  const namespacet &ns)
+{
+  bool changed = !replace.replace(expr);
+
+  if(changed && has_subexpr(expr, is_constant_choice))
+    lift_constant_choices(expr);
+
+  if(changed)
+    simplify(expr, ns);
+
+  return changed;
+}
+
+simplify_equation_statisticst
+simplify_equation(symex_target_equationt &equation, const namespacet &ns)
+{
+  PRECONDITION(!equation.has_threads());
+
+  simplify_equation_statisticst statistics;
+  address_of_aware_replace_symbolt replace;
+
+  // a guard or condition that has become constant
+  auto rewrite_condition = [&](exprt &condition) {
+    const bool was_constant = condition.is_constant();
+    if(!rewrite(condition, replace, ns))
+      return;
+
+    ++statistics.rewritten_expressions;
+    if(!was_constant && condition.is_constant())
+      ++statistics.decided_conditions;
+  };
+
+  for(auto &step : equation.SSA_steps)
+  {
+    if(step.ignore || step.converted)
+      continue;
+
+    rewrite_condition(step.guard);
+
+    if(step.is_assignment())
+    {
+      if(rewrite(step.ssa_rhs, replace, ns))
+      {
+        ++statistics.rewritten_expressions;
+        step.cond_expr = equal_exprt(step.ssa_lhs, step.ssa_rhs);
+      }
+
+      if(
+        is_propagated_definition(step.ssa_rhs) &&
+        step.ssa_lhs.type() == step.ssa_rhs.type())
+      {
+        replace.insert(step.ssa_lhs, step.ssa_rhs);
+        ++statistics.propagated_symbols;
+      }
+    }
+    else if(
+      step.is_assume() || step.is_assert() || step.is_goto() ||
+      step.is_constraint())
+    {
+      rewrite_condition(step.cond_expr);
+    }
+  }
+
+  return statistics;
+}
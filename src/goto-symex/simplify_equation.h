@@ -0,0 +1,50 @@
+/*******************************************************************\
+
+Module: Word-Level Simplification of the Equation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Word-Level Simplification of the Equation
+
+#ifndef CPROVER_GOTO_SYMEX_SIMPLIFY_EQUATION_H
+#define CPROVER_GOTO_SYMEX_SIMPLIFY_EQUATION_H
+
+#include <cstddef>
+
+class namespacet;
+class symex_target_equationt;
+
+struct simplify_equation_statisticst
+{
+  /// Symbols whose definitions have been substituted into their uses
+  std::size_t propagated_symbols = 0;
+
+  /// Guards, conditions and right-hand sides that have been rewritten
+  std::size_t rewritten_expressions = 0;
+
+  /// Guards and conditions that have become constant
+  std::size_t decided_conditions = 0;
+};
+
+/// Rewrites the not yet converted steps of \p equation before it is passed
+/// to the decision procedure, such that it becomes cheaper to convert.
+///
+/// As every SSA symbol is assigned once, and the assignments hold regardless
+/// of the guard, the definition of a symbol may be substituted into all the
+/// subsequent steps. This is done for definitions by constants, by other
+/// symbols and by conditional expressions that choose between constants
+/// depending on a symbol, as obtained from merging constants at join points.
+/// Operators applied to such a conditional expression and a constant are
+/// lifted into its branches, e.g., `(c ? 1 : 2) == 1` becomes `c`. All
+/// rewritten expressions are simplified.
+///
+/// The definitions themselves are kept, hence the values of all symbols
+/// remain available for counterexample traces. The equation must not have
+/// threads, whose shared reads are not ordered by the SSA steps.
+simplify_equation_statisticst
+simplify_equation(symex_target_equationt &equation, const namespacet &ns);
+
+#endif // CPROVER_GOTO_SYMEX_SIMPLIFY_EQUATION_H
@@ -146,6 +146,10 @@ void SSA_stept::validate(const namespacet &ns, const validation_modet vm) const
     validate_full_expr(ssa_lhs, ns, vm);
     validate_full_expr(ssa_full_lhs, ns, vm);
     validate_full_expr(original_full_lhs, ns, vm);
+    // the right-hand side of a streamed assignment may have been dropped
+    // after it has been validated, see symex_target_equationt::stream_to
+    if(streamed && ssa_rhs.is_nil())
+      break;
     validate_full_expr(ssa_rhs, ns, vm);
     DATA_CHECK(
       vm,
@@ -143,16 +143,17 @@ public:
   exprt ssa_rhs;
   symex_targett::assignment_typet assignment_type;
 
-  // for ASSUME/ASSERT/GOTO/CONSTRAINT
+  // for ASSUME/ASSERT/GOTO/CONSTRAINT; the comment is interned as the
+  // same message recurs in every unwinding of a loop
+  irep_idt comment;
   exprt cond_expr;
   exprt cond_handle;
-  std::string comment;
 
   // for INPUT/OUTPUT
   irep_idt format_string, io_id;
-  bool formatted = false;
   std::list<exprt> io_args;
   std::list<exprt> converted_io_args;
+  bool formatted = false;
 
   // for function calls: the function that is called
   irep_idt called_function;
@@ -169,6 +170,9 @@ public:
   // for incremental conversion
   bool converted = false;
 
+  // converted when recorded, see symex_target_equationt::stream_to
+  bool streamed = false;
+
   SSA_stept(
     const symex_targett::sourcet &_source,
     goto_trace_stept::typet _type)
@@ -54,6 +54,20 @@ struct symex_configt final
   /// enables certain analyses that otherwise aren't run.
   bool complexity_limits_active;
 
+  /// \brief Whether to replace the right-hand sides of assignments by a
+  /// structurally equal expression seen before, if any. Values recorded for
+  /// constant propagation and the SSA steps then share their nodes, such
+  /// that comparing and hashing equal expressions is cheap.
+  bool hash_consing;
+
+  /// \brief Maximum number of simplification results kept for reuse during
+  /// symbolic execution, 0 (the default) disables caching.
+  std::size_t simplify_cache_size;
+
+  /// \brief Whether to reuse the return values of earlier calls to functions
+  /// without side effects, see \ref function_summariest.
+  bool function_summaries;
+
   /// \brief Construct a symex_configt using options specified in an
   /// \ref optionst
   explicit symex_configt(const optionst &options);
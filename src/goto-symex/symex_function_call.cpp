@@ -21,6 +21,8 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/prefix.h>
 #include <util/range.h>
 
+#include <goto-programs/remove_returns.h>
+
 #include "expr_skeleton.h"
 #include "symex_assign.h"
 
@@ -143,7 +145,8 @@ void goto_symext::parameter_assignments(
       rhs = clean_expr(std::move(rhs), state, false);
 
       exprt::operandst lhs_conditions;
-      symex_assignt{state, assignment_type, ns, symex_config, target}
+      symex_assignt{
+        state, assignment_type, ns, symex_config, target, &simplify_cache}
         .assign_rec(lhs, expr_skeletont{}, rhs, lhs_conditions);
     }
 
@@ -317,6 +320,46 @@ void goto_symext::symex_function_call_code(
     return;
   }
 
+  // reuse the return value of an earlier call with the same inputs
+  exprt summary_key = nil_exprt();
+  if(
+    symex_config.function_summaries && !symex_config.doing_path_exploration &&
+    state.threads.size() == 1)
+  {
+    const auto &summarisable =
+      function_summaries.summarisable(identifier, goto_function, ns);
+
+    if(summarisable.has_value())
+    {
+      exprt::operandst values;
+      for(const auto &argument : renamed_arguments)
+        values.push_back(argument.get());
+      for(const auto &global : summarisable->read_globals)
+        values.push_back(state.rename(global, ns).get());
+      if(summarisable->has_jumps)
+        values.push_back(state.guard.as_expr());
+
+      summary_key =
+        function_summariest::make_key(identifier, std::move(values));
+
+      if(const exprt *return_value = function_summaries.find(summary_key))
+      {
+        target.function_return(
+          state.guard.as_expr(), identifier, state.source, hidden);
+
+        if(return_value->is_not_nil())
+        {
+          symex_assign(
+            state,
+            code_assignt{return_value_symbol(identifier, ns), *return_value});
+        }
+
+        symex_transition(state);
+        return;
+      }
+    }
+  }
+
   // produce a new frame
   PRECONDITION(!state.call_stack().empty());
   framet &frame = state.call_stack().new_frame(state.source, state.guard);
@@ -339,6 +382,7 @@ void goto_symext::symex_function_call_code(
   frame.return_value=call.lhs();
   frame.function_identifier=identifier;
   frame.hidden_function = callee_is_hidden;
+  frame.summary_key = std::move(summary_key);
 
   const framet &p_frame = state.call_stack().previous_frame();
   for(const auto &pair : p_frame.loop_iterations)
@@ -423,7 +467,18 @@ static void pop_frame(
 /// do function call by inlining
 void goto_symext::symex_end_of_function(statet &state)
 {
-  const bool hidden = state.call_stack().top().hidden_function;
+  const framet &frame = state.call_stack().top();
+  const bool hidden = frame.hidden_function;
+
+  if(frame.summary_key.is_not_nil() && state.reachable)
+  {
+    exprt return_value = nil_exprt();
+    const symbolt *symbol;
+    if(!ns.lookup(return_value_identifier(frame.function_identifier), symbol))
+      return_value = state.rename(symbol->symbol_expr(), ns).get();
+
+    function_summaries.insert(frame.summary_key, std::move(return_value));
+  }
 
   // first record the return
   target.function_return(
@@ -55,7 +55,11 @@ symex_configt::symex_configt(const optionst &options)
                 "max-field-sensitivity-array-size")
             : DEFAULT_MAX_FIELD_SENSITIVITY_ARRAY_SIZE),
     complexity_limits_active(
-      options.get_signed_int_option("symex-complexity-limit") > 0)
+      options.get_signed_int_option("symex-complexity-limit") > 0),
+    hash_consing(options.get_bool_option("symex-hash-consing")),
+    simplify_cache_size(
+      options.get_unsigned_int_option("symex-simplify-cache")),
+    function_summaries(options.get_bool_option("symex-function-summaries"))
 {
 }
 
@@ -357,6 +361,10 @@ void goto_symext::symex_with_state(
   // as state.symbol_table might go out of scope
   reset_namespacet reset_ns(ns);
 
+  // the cached results may depend on the symbols of another state
+  simplify_cache.clear();
+  function_summaries.clear();
+
   PRECONDITION(state.call_stack().top().end_of_function->is_end_function());
 
   symex_threaded_step(state, get_goto_function);
@@ -371,6 +379,21 @@ void goto_symext::symex_with_state(
       return;
   }
 
+  if(simplify_cache.is_enabled())
+  {
+    log.statistics() << "Simplifier cache: " << simplify_cache.hits
+                     << " hits, " << simplify_cache.misses << " misses, "
+                     << simplify_cache.evictions << " evictions"
+                     << messaget::eom;
+  }
+
+  if(symex_config.function_summaries)
+  {
+    log.statistics() << "Function summaries: " << function_summaries.recorded
+                     << " recorded, " << function_summaries.hits << " reused"
+                     << messaget::eom;
+  }
+
   // Clients may need to construct a namespace with both the names in
   // the original goto-program and the names generated during symbolic
   // execution, so return the names generated through symbolic execution
@@ -12,7 +12,9 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "symex_target_equation.h"
 
+#include <util/expr_util.h>
 #include <util/format_expr.h>
+#include <util/namespace.h>
 #include <util/std_expr.h>
 
 #include <solvers/decision_procedure.h>
@@ -43,6 +45,7 @@ void symex_target_equationt::shared_read(
   SSA_step.atomic_section_id=atomic_section_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::shared_write(
@@ -59,6 +62,7 @@ void symex_target_equationt::shared_write(
   SSA_step.atomic_section_id=atomic_section_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 /// spawn a new thread
@@ -71,6 +75,7 @@ void symex_target_equationt::spawn(
   SSA_step.guard=guard;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::memory_barrier(
@@ -82,6 +87,7 @@ void symex_target_equationt::memory_barrier(
   SSA_step.guard=guard;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 /// start an atomic section
@@ -96,6 +102,7 @@ void symex_target_equationt::atomic_begin(
   SSA_step.atomic_section_id=atomic_section_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 /// end an atomic section
@@ -110,6 +117,7 @@ void symex_target_equationt::atomic_end(
   SSA_step.atomic_section_id=atomic_section_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::assignment(
@@ -132,6 +140,7 @@ void symex_target_equationt::assignment(
                                               assignment_type});
 
   merge_ireps(SSA_steps.back());
+  stream(SSA_steps.back());
 }
 
 void symex_target_equationt::decl(
@@ -157,6 +166,7 @@ void symex_target_equationt::decl(
   SSA_step.cond_expr=equal_exprt(SSA_step.ssa_lhs, SSA_step.ssa_lhs);
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 /// declare a fresh variable
@@ -178,6 +188,7 @@ void symex_target_equationt::location(
   SSA_step.guard=guard;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::function_call(
@@ -197,6 +208,7 @@ void symex_target_equationt::function_call(
   SSA_step.hidden = hidden;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::function_return(
@@ -213,6 +225,7 @@ void symex_target_equationt::function_return(
   SSA_step.hidden = hidden;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::output(
@@ -230,6 +243,7 @@ void symex_target_equationt::output(
   SSA_step.io_id=output_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::output_fmt(
@@ -249,6 +263,7 @@ void symex_target_equationt::output_fmt(
   SSA_step.format_string=fmt;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::input(
@@ -265,6 +280,7 @@ void symex_target_equationt::input(
   SSA_step.io_id=input_id;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::assumption(
@@ -279,6 +295,7 @@ void symex_target_equationt::assumption(
   SSA_step.cond_expr=cond;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::assertion(
@@ -295,6 +312,7 @@ void symex_target_equationt::assertion(
   SSA_step.comment=msg;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::goto_instruction(
@@ -309,6 +327,7 @@ void symex_target_equationt::goto_instruction(
   SSA_step.cond_expr = cond.get();
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::constraint(
@@ -325,6 +344,7 @@ void symex_target_equationt::constraint(
   SSA_step.comment=msg;
 
   merge_ireps(SSA_step);
+  stream(SSA_step);
 }
 
 void symex_target_equationt::convert_without_assertions(
@@ -397,6 +417,13 @@ void symex_target_equationt::convert_guards(
   std::size_t step_index = 0;
   for(auto &step : SSA_steps)
   {
+    // streamed steps have been converted when they were recorded
+    if(step.streamed)
+    {
+      ++step_index;
+      continue;
+    }
+
     if(step.ignore)
       step.guard_handle = false_exprt();
     else
@@ -420,7 +447,7 @@ void symex_target_equationt::convert_assumptions(
   std::size_t step_index = 0;
   for(auto &step : SSA_steps)
   {
-    if(step.is_assume())
+    if(step.is_assume() && !step.streamed)
     {
       if(step.ignore)
         step.cond_handle = true_exprt();
@@ -448,7 +475,7 @@ void symex_target_equationt::convert_goto_instructions(
   std::size_t step_index = 0;
   for(auto &step : SSA_steps)
   {
-    if(step.is_goto())
+    if(step.is_goto() && !step.streamed)
     {
       if(step.ignore)
         step.cond_handle = true_exprt();
@@ -682,6 +709,66 @@ void symex_target_equationt::convert_io(decision_proceduret &decision_procedure)
   }
 }
 
+/// \return true if \p expr refers to a dynamically allocated object, which
+///   makes the trace step of an assignment internal, see build_goto_trace
+static bool
+refers_to_dynamic_object(const exprt &expr, const namespacet &ns)
+{
+  return has_subexpr(expr, [&ns](const exprt &e) {
+    if(!is_ssa_expr(e))
+      return false;
+
+    const symbolt *symbol;
+    return !ns.lookup(to_ssa_expr(e).get_original_name(), symbol) &&
+           symbol->type.get_bool(ID_C_dynamic);
+  });
+}
+
+void symex_target_equationt::stream(SSA_stept &SSA_step)
+{
+  if(streaming_decision_procedure == nullptr)
+    return;
+
+  decision_proceduret &decision_procedure = *streaming_decision_procedure;
+
+  if(streaming_validate)
+    SSA_step.validate(*streaming_ns, validation_modet::INVARIANT);
+
+  log.conditional_output(log.debug(), [&SSA_step](messaget::mstreamt &mstream) {
+    SSA_step.output(mstream);
+    mstream << messaget::eom;
+  });
+
+  SSA_step.guard_handle = decision_procedure.handle(SSA_step.guard);
+
+  if(SSA_step.is_assignment() || SSA_step.is_constraint())
+  {
+    decision_procedure.set_to_true(SSA_step.cond_expr);
+    SSA_step.converted = true;
+  }
+  else if(SSA_step.is_decl())
+  {
+    decision_procedure.handle(SSA_step.cond_expr);
+    SSA_step.converted = true;
+  }
+  else if(SSA_step.is_assume() || SSA_step.is_goto())
+    SSA_step.cond_handle = decision_procedure.handle(SSA_step.cond_expr);
+
+  with_solver_hardness(
+    decision_procedure, hardness_register_ssa(SSA_steps.size() - 1, SSA_step));
+
+  SSA_step.streamed = true;
+
+  // the equality is only held by the decision procedure from now on
+  if(
+    SSA_step.is_assignment() &&
+    !refers_to_dynamic_object(SSA_step.ssa_rhs, *streaming_ns))
+  {
+    SSA_step.ssa_rhs.make_nil();
+    SSA_step.cond_expr.make_nil();
+  }
+}
+
 /// Merging causes identical ireps to be shared.
 /// This is only enabled if the definition SHARING is defined.
 /// \param SSA_step The step you want to have shared values.
@@ -30,7 +30,6 @@ Author: Daniel Kroening, kroening@kroening.com
 
 class decision_proceduret;
 class namespacet;
-class decision_proceduret;
 class hardness_collectort;
 struct solver_hardnesst;
 
@@ -235,6 +234,27 @@ public:
   /// \param decision_procedure: A handle to a decision procedure interface
   void convert_io(decision_proceduret &decision_procedure);
 
+  /// Converts the guards, assignments, declarations, assumptions, goto
+  /// conditions and constraints into \p decision_procedure as they are
+  /// recorded rather than when the equation is complete, and drops the
+  /// right-hand sides of assignments afterwards, which traces do not need.
+  /// The other steps, in particular assertions, are converted as usual.
+  /// Steps must not be sliced or rewritten afterwards, and
+  /// \p decision_procedure must outlive the recording.
+  /// \param decision_procedure: A handle to a decision procedure interface
+  /// \param ns: Namespace to look up the objects assigned to
+  /// \param validate: Whether to validate each step before it is converted,
+  ///   as the right-hand sides are no longer there to validate afterwards
+  void stream_to(
+    decision_proceduret &decision_procedure,
+    const namespacet &ns,
+    bool validate)
+  {
+    streaming_decision_procedure = &decision_procedure;
+    streaming_ns = &ns;
+    streaming_validate = validate;
+  }
+
   exprt make_expression() const;
 
   std::size_t count_assertions() const
@@ -253,6 +273,9 @@ public:
       }));
   }
 
+  // A list rather than a vector: iterators to steps are kept while steps
+  // are added, e.g., by the goal instances of the property deciders and by
+  // the memory models, and the initial writes are spliced in front.
   typedef std::list<SSA_stept> SSA_stepst;
   SSA_stepst SSA_steps;
 
@@ -288,6 +311,14 @@ public:
       step.validate(ns, vm);
   }
 
+  /// Replaces \p expr and its subexpressions by structurally equal ones
+  /// stored in the SSA steps before, sharing their nodes. As for the SSA
+  /// steps, comments are disregarded, see \ref merge_irept.
+  void merge_expr(exprt &expr)
+  {
+    merge_irep(expr);
+  }
+
 protected:
   messaget log;
 
@@ -300,6 +331,12 @@ protected:
 
   // for unique function call argument identifiers
   std::size_t argument_count = 0;
+
+  // for converting steps as they are recorded
+  decision_proceduret *streaming_decision_procedure = nullptr;
+  const namespacet *streaming_ns = nullptr;
+  bool streaming_validate = false;
+  void stream(SSA_stept &SSA_step);
 };
 
 inline bool operator<(
@@ -14,10 +14,27 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <fstream>
 #include <iostream>
 
+#include <solvers/sat/binary_cnf.h>
 #include <solvers/sat/dimacs_cnf.h>
 
 bool bv_dimacst::write_dimacs()
 {
+  // the binary format has no room for the mapping
+  auto binary_writer = dynamic_cast<binary_cnf_writert *>(&prop);
+  if(binary_writer != nullptr)
+  {
+    binary_writer->write_header();
+    return false;
+  }
+
+  auto dimacs_stream = dynamic_cast<dimacs_cnf_streamt *>(&prop);
+  if(dimacs_stream != nullptr)
+  {
+    dimacs_stream->write_problem_line();
+    write_mapping(dimacs_stream->get_stream());
+    return false;
+  }
+
   if(filename.empty() || filename == "-")
     return write_dimacs(std::cout);
 
@@ -35,7 +52,12 @@ bool bv_dimacst::write_dimacs()
 bool bv_dimacst::write_dimacs(std::ostream &out)
 {
   dynamic_cast<dimacs_cnft &>(prop).write_dimacs_cnf(out);
+  write_mapping(out);
+  return false;
+}
 
+void bv_dimacst::write_mapping(std::ostream &out)
+{
   // we dump the mapping variable<->literals
   for(const auto &s : get_symbols())
   {
@@ -67,6 +89,4 @@ bool bv_dimacst::write_dimacs(std::ostream &out)
 
     out << "\n";
   }
-
-  return false;
 }
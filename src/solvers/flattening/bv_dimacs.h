@@ -14,6 +14,12 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "bv_pointers.h"
 
+/// Writes the formula in DIMACS format, followed by comments that map the
+/// symbols to literals. With a `dimacs_cnft` the clauses are collected and
+/// written to \p _filename (or the standard output if it is empty or "-")
+/// on destruction. With a `dimacs_cnf_streamt` the clauses have been
+/// written already, and only the problem line and the mapping are added.
+/// With a `binary_cnf_writert` only the header is completed.
 class bv_dimacst : public bv_pointerst
 {
 public:
@@ -35,6 +41,7 @@ protected:
   const std::string filename;
   bool write_dimacs();
   bool write_dimacs(std::ostream &);
+  void write_mapping(std::ostream &);
 };
 
 #endif // CPROVER_SOLVERS_FLATTENING_BV_DIMACS_H
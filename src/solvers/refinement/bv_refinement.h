@@ -28,6 +28,9 @@ private:
     bool refine_arrays=true;
     /// Enable arithmetic refinement
     bool refine_arithmetic=true;
+    /// Multiplication, division and remainder of bit-vectors narrower than
+    /// this are converted eagerly when refining arithmetic
+    std::size_t min_arithmetic_width = 0;
   };
 public:
   struct infot:public configt
@@ -57,6 +60,10 @@ protected:
   bvt convert_mod(const mod_exprt &expr) override;
   bvt convert_floatbv_op(const ieee_float_op_exprt &) override;
 
+  /// Whether \p expr, a multiplication, division or remainder, is to be
+  /// approximated rather than converted eagerly
+  bool refine_arithmetic_op(const exprt &expr);
+
 private:
   // the list of operator approximations
   struct approximationt final
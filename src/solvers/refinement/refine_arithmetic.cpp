@@ -46,9 +46,18 @@ bvt bv_refinementt::convert_floatbv_op(const ieee_float_op_exprt &expr)
   return bv;
 }
 
-bvt bv_refinementt::convert_mult(const mult_exprt &expr)
+bool bv_refinementt::refine_arithmetic_op(const exprt &expr)
 {
   if(!config_.refine_arithmetic || expr.type().id()==ID_fixedbv)
+    return false;
+
+  // narrow circuits are cheap enough to be built right away
+  return boolbv_width(expr.type()) >= config_.min_arithmetic_width;
+}
+
+bvt bv_refinementt::convert_mult(const mult_exprt &expr)
+{
+  if(!refine_arithmetic_op(expr))
     return SUB::convert_mult(expr);
 
   // we catch any multiplication
@@ -96,7 +105,7 @@ bvt bv_refinementt::convert_mult(const mult_exprt &expr)
 
 bvt bv_refinementt::convert_div(const div_exprt &expr)
 {
-  if(!config_.refine_arithmetic || expr.type().id()==ID_fixedbv)
+  if(!refine_arithmetic_op(expr))
     return SUB::convert_div(expr);
 
   // we catch any division
@@ -114,7 +123,7 @@ bvt bv_refinementt::convert_div(const div_exprt &expr)
 
 bvt bv_refinementt::convert_mod(const mod_exprt &expr)
 {
-  if(!config_.refine_arithmetic || expr.type().id()==ID_fixedbv)
+  if(!refine_arithmetic_op(expr))
     return SUB::convert_mod(expr);
 
   // we catch any mod
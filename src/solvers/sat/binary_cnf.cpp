@@ -0,0 +1,122 @@
+/*******************************************************************\
+
+Module: Binary CNF Format
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Binary CNF Format
+
+#include "binary_cnf.h"
+
+#include <util/exception_utils.h>
+#include <util/invariant.h>
+#include <util/irep_serialization.h>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+
+static const char binary_cnf_magic[] = {'C', 'N', 'F', 1};
+
+/// The number of bytes used for the number of variables
+static const unsigned binary_cnf_count_bytes = 8;
+
+binary_cnf_writert::binary_cnf_writert(
+  std::ostream &_out,
+  message_handlert &message_handler)
+  : cnft(message_handler), out(_out), clause_count(0)
+{
+  header_position = out.tellp();
+  write_header();
+}
+
+void binary_cnf_writert::write_header()
+{
+  out.seekp(header_position);
+
+  out.write(binary_cnf_magic, sizeof(binary_cnf_magic));
+
+  std::size_t count = no_variables();
+  for(unsigned i = 0; i < binary_cnf_count_bytes; ++i)
+  {
+    out.put(static_cast<char>(count & 0xff));
+    count >>= 8;
+  }
+
+  out.seekp(0, std::ios_base::end);
+}
+
+void binary_cnf_writert::lcnf(const bvt &bv)
+{
+  bvt new_bv;
+
+  if(process_clause(bv, new_bv))
+    return;
+
+  // constants have been removed, hence no literal is encoded as zero
+  for(const auto &l : new_bv)
+    write_gb_word(out, l.get());
+
+  write_gb_word(out, 0);
+  ++clause_count;
+}
+
+void binary_cnf_writert::set_assignment(literalt, bool)
+{
+  UNIMPLEMENTED;
+}
+
+bool binary_cnf_writert::is_in_conflict(literalt) const
+{
+  UNREACHABLE;
+  return false;
+}
+
+void read_binary_cnf(std::istream &in, cnft &dest)
+{
+  char magic[sizeof(binary_cnf_magic)];
+  in.read(magic, sizeof(magic));
+
+  if(!in || !std::equal(magic, magic + sizeof(magic), binary_cnf_magic))
+    throw deserialization_exceptiont("not in binary CNF format");
+
+  std::size_t no_variables = 0;
+  for(unsigned i = 0; i < binary_cnf_count_bytes; ++i)
+  {
+    const int byte = in.get();
+    if(byte == std::char_traits<char>::eof())
+      throw deserialization_exceptiont("unexpected end of input stream");
+    no_variables |= std::size_t(byte & 0xff) << (8 * i);
+  }
+
+  dest.set_no_variables(no_variables);
+
+  bvt clause;
+
+  // each clause starts with a literal or its terminating zero
+  while(in.peek() != std::char_traits<char>::eof())
+  {
+    const std::size_t code = irep_serializationt::read_gb_word(in);
+
+    if(code == 0)
+    {
+      dest.lcnf(clause);
+      clause.clear();
+      continue;
+    }
+
+    literalt l;
+    l.set(static_cast<literalt::var_not>(code));
+
+    if(l.get() != code || l.var_no() == 0 || l.var_no() >= no_variables)
+      throw deserialization_exceptiont("literal out of range");
+
+    clause.push_back(l);
+  }
+
+  if(!clause.empty())
+    throw deserialization_exceptiont("unterminated clause");
+}
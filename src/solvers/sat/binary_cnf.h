@@ -0,0 +1,77 @@
+/*******************************************************************\
+
+Module: Binary CNF Format
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// A compact binary format for CNF formulas, for storing formulas that are
+/// to be solved elsewhere or later.
+///
+/// The format consists of the four bytes "CNF" and 1 (the version), the
+/// number of variables (including the unused variable 0, see
+/// `cnft::no_variables`) as eight bytes, least-significant byte first,
+/// followed by the clauses. Each clause is a sequence of literals, each
+/// encoded as `literalt::get()` using `write_gb_word`, and terminated by
+/// a zero.
+
+#ifndef CPROVER_SOLVERS_SAT_BINARY_CNF_H
+#define CPROVER_SOLVERS_SAT_BINARY_CNF_H
+
+#include <iosfwd>
+
+#include "cnf.h"
+
+/// Writes the clauses in the binary CNF format as they are added, such that
+/// they need not be kept in memory. The stream must be seekable: the
+/// number of variables is filled in by `write_header` once all clauses have
+/// been added. Use `cnf_clause_listt::copy_to` to write a collected formula.
+class binary_cnf_writert : public cnft
+{
+public:
+  binary_cnf_writert(std::ostream &_out, message_handlert &message_handler);
+
+  const std::string solver_text() override
+  {
+    return "binary CNF writer";
+  }
+
+  void lcnf(const bvt &bv) override;
+
+  tvt l_get(literalt) const override
+  {
+    return tvt::unknown();
+  }
+
+  size_t no_clauses() const override
+  {
+    return clause_count;
+  }
+
+  // dummy functions
+  void set_assignment(literalt a, bool value) override;
+  bool is_in_conflict(literalt l) const override;
+
+  /// Fills in the number of variables and moves back to the end of the
+  /// stream
+  void write_header();
+
+protected:
+  resultt do_prop_solve() override
+  {
+    return resultt::P_ERROR;
+  }
+
+  std::ostream &out;
+  std::streampos header_position;
+  std::size_t clause_count;
+};
+
+/// Adds the formula in binary CNF format read from \p in to \p dest, which
+/// can be any SAT solver.
+/// \throws deserialization_exceptiont if the input is not in the format
+void read_binary_cnf(std::istream &in, cnft &dest);
+
+#endif // CPROVER_SOLVERS_SAT_BINARY_CNF_H
@@ -271,6 +271,9 @@ literalt cnft::land(literalt a, literalt b)
   if(a==b)
     return a;
 
+  if(structural_hashing)
+    return hashed_land(a, b);
+
   literalt o=new_variable();
   gate_and(a, b, o);
   return o;
@@ -287,6 +290,9 @@ literalt cnft::lor(literalt a, literalt b)
   if(a==b)
     return a;
 
+  if(structural_hashing)
+    return !hashed_land(!a, !b);
+
   literalt o=new_variable();
   gate_or(a, b, o);
   return o;
@@ -309,11 +315,108 @@ literalt cnft::lxor(literalt a, literalt b)
   if(a==!b)
     return const_literal(true);
 
+  if(structural_hashing)
+    return hashed_lxor(a, b);
+
   literalt o=new_variable();
   gate_xor(a, b, o);
   return o;
 }
 
+/// Forgets the gates if the solver has been called since they were added
+void cnft::invalidate_gates()
+{
+  if(gates_solver_calls == get_number_of_solver_calls())
+    return;
+
+  and_gates.clear();
+  xor_gates.clear();
+  and_gate_inputs.clear();
+  gates_solver_calls = get_number_of_solver_calls();
+}
+
+/// AND gate with structural hashing and two-level rewriting
+/// \par parameters: Two non-constant, distinct inputs to the AND gate
+/// \return Output signal of the AND gate as literal
+literalt cnft::hashed_land(literalt a, literalt b)
+{
+  if(a==!b)
+    return const_literal(false);
+
+  invalidate_gates();
+
+  // rewrite a & g, where g is the output of an AND gate over p and q
+  for(int i=0; i<2; i++)
+  {
+    const literalt x=i==0 ? a : b;
+    const literalt g=i==0 ? b : a;
+
+    const auto inputs=and_gate_inputs.find(g.var_no());
+    if(inputs==and_gate_inputs.end())
+      continue;
+
+    const literalt p=inputs->second.first;
+    const literalt q=inputs->second.second;
+
+    if(!g.sign())
+    {
+      // x & (x & q) = x & q
+      if(x==p || x==q)
+        return g;
+      // x & (!x & q) = false
+      if(x==!p || x==!q)
+        return const_literal(false);
+    }
+    else
+    {
+      // x & !(!x & q) = x
+      if(x==!p || x==!q)
+        return x;
+    }
+  }
+
+  if(b<a)
+    std::swap(a, b);
+
+  const gate_keyt key(a.get(), b.get());
+  const auto entry=and_gates.find(key);
+  if(entry!=and_gates.end())
+    return entry->second;
+
+  literalt o=new_variable();
+  gate_and(a, b, o);
+  and_gates.emplace(key, o);
+  and_gate_inputs.emplace(o.var_no(), std::make_pair(a, b));
+  return o;
+}
+
+/// XOR gate with structural hashing
+/// \par parameters: Two non-constant inputs to the XOR gate over distinct
+///   variables
+/// \return Output signal of the XOR gate as literal
+literalt cnft::hashed_lxor(literalt a, literalt b)
+{
+  invalidate_gates();
+
+  // !a xor b = !(a xor b), hence store the gate over unsigned inputs
+  const bool sign=a.sign()!=b.sign();
+  a=literalt(a.var_no(), false);
+  b=literalt(b.var_no(), false);
+
+  if(b<a)
+    std::swap(a, b);
+
+  const gate_keyt key(a.get(), b.get());
+  const auto entry=xor_gates.find(key);
+  if(entry!=xor_gates.end())
+    return entry->second^sign;
+
+  literalt o=new_variable();
+  gate_xor(a, b, o);
+  xor_gates.emplace(key, o);
+  return o^sign;
+}
+
 /// \par parameters: Two inputs to the NAND gate
 /// \return Output signal of the NAND gate as literal
 literalt cnft::lnand(literalt a, literalt b)
@@ -14,6 +14,10 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <solvers/prop/prop.h>
 
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+
 class cnft:public propt
 {
 public:
@@ -42,6 +46,18 @@ public:
   virtual void set_no_variables(size_t no) { _no_variables=no; }
   virtual size_t no_clauses() const=0;
 
+  /// Enables structural hashing of two-input gates: AND, OR (as a negated
+  /// AND of the negated inputs) and XOR gates over the same inputs then
+  /// share a single output variable and their clauses are added only once.
+  /// AND gates are additionally subject to two-level rewriting, e.g.,
+  /// a & (a & b) = a & b and a & (!a & b) = false.
+  /// The gates are forgotten whenever the solver is called, as a
+  /// preprocessing solver may eliminate their variables.
+  void set_structural_hashing(bool value)
+  {
+    structural_hashing = value;
+  }
+
 protected:
   void gate_and(literalt a, literalt b, literalt o);
   void gate_or(literalt a, literalt b, literalt o);
@@ -57,6 +73,34 @@ protected:
 
   bool process_clause(const bvt &bv, bvt &dest);
 
+  bool structural_hashing = false;
+
+  /// Two-input gates, keyed by their input literals; XOR gates are
+  /// stored with unsigned inputs, see \ref set_structural_hashing
+  using gate_keyt = std::pair<unsigned, unsigned>;
+
+  struct gate_key_hasht
+  {
+    std::size_t operator()(const gate_keyt &key) const
+    {
+      return std::hash<std::uint64_t>()(
+        (std::uint64_t(key.first) << 32) | key.second);
+    }
+  };
+
+  std::unordered_map<gate_keyt, literalt, gate_key_hasht> and_gates;
+  std::unordered_map<gate_keyt, literalt, gate_key_hasht> xor_gates;
+
+  /// The inputs of the AND gates, indexed by the output variable
+  std::unordered_map<unsigned, std::pair<literalt, literalt>> and_gate_inputs;
+
+  /// The number of solver calls when the gates were last valid
+  std::size_t gates_solver_calls = 0;
+
+  void invalidate_gates();
+  literalt hashed_land(literalt a, literalt b);
+  literalt hashed_lxor(literalt a, literalt b);
+
   static bool is_all(const bvt &bv, literalt l)
   {
     forall_literals(it, bv)
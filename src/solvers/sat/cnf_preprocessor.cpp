@@ -0,0 +1,663 @@
+/*******************************************************************\
+
+Module: CNF Preprocessing
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// CNF Preprocessing
+
+#include "cnf_preprocessor.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <util/invariant.h>
+
+cnf_preprocessort::cnf_preprocessort(
+  std::size_t _no_variables,
+  message_handlert &message_handler)
+  : log(message_handler),
+    no_variables(_no_variables),
+    occurrences(2 * _no_variables),
+    frozen(_no_variables, false),
+    eliminated(_no_variables, false),
+    fixed(_no_variables, tvt::unknown()),
+    unsatisfiable(false),
+    eliminated_variables(0),
+    substituted_variables(0),
+    subsumed_clauses(0),
+    strengthened_clauses(0),
+    blocked_clauses(0)
+{
+}
+
+void cnf_preprocessort::set_frozen(literalt literal)
+{
+  if(!literal.is_constant() && literal.var_no() < no_variables)
+    frozen[literal.var_no()] = true;
+}
+
+bool cnf_preprocessort::normalize(bvt &clause) const
+{
+  bvt dest;
+  dest.reserve(clause.size());
+
+  for(const auto l : clause)
+  {
+    if(l.is_true())
+      return true;
+    if(l.is_false())
+      continue;
+
+    const tvt value = fixed[l.var_no()];
+    if(value.is_unknown())
+      dest.push_back(l);
+    else if(value.is_true() != l.sign())
+      return true;
+  }
+
+  std::sort(dest.begin(), dest.end());
+  dest.erase(std::unique(dest.begin(), dest.end()), dest.end());
+
+  // a literal and its negation are adjacent after sorting
+  for(std::size_t i = 1; i < dest.size(); ++i)
+  {
+    if(dest[i - 1] == !dest[i])
+      return true;
+  }
+
+  clause.swap(dest);
+  return false;
+}
+
+void cnf_preprocessort::add_clause(bvt clause)
+{
+  if(normalize(clause))
+    return;
+
+  if(clause.empty())
+  {
+    unsatisfiable = true;
+    return;
+  }
+
+  const std::size_t index = clauses.size();
+  for(const auto l : clause)
+    occurrences[l.get()].push_back(index);
+
+  clauses.push_back(std::move(clause));
+  removed.push_back(false);
+}
+
+void cnf_preprocessort::remove_clause(std::size_t index)
+{
+  removed[index] = true;
+}
+
+void cnf_preprocessort::remove_literal(std::size_t index, literalt literal)
+{
+  bvt &clause = clauses[index];
+  clause.erase(std::remove(clause.begin(), clause.end(), literal), clause.end());
+
+  if(clause.empty())
+    unsatisfiable = true;
+}
+
+const std::vector<std::size_t> &
+cnf_preprocessort::live_occurrences(literalt literal)
+{
+  auto &list = occurrences[literal.get()];
+
+  list.erase(
+    std::remove_if(
+      list.begin(),
+      list.end(),
+      [this, literal](std::size_t index) {
+        return removed[index] || !std::binary_search(
+                                   clauses[index].begin(),
+                                   clauses[index].end(),
+                                   literal);
+      }),
+    list.end());
+
+  return list;
+}
+
+void cnf_preprocessort::propagate_units()
+{
+  std::vector<literalt> queue;
+
+  for(std::size_t i = 0; i < clauses.size(); ++i)
+  {
+    if(!removed[i] && clauses[i].size() == 1)
+      queue.push_back(clauses[i].front());
+  }
+
+  while(!queue.empty() && !unsatisfiable)
+  {
+    const literalt l = queue.back();
+    queue.pop_back();
+
+    tvt &value = fixed[l.var_no()];
+    if(!value.is_unknown())
+    {
+      if(value.is_true() == l.sign())
+        unsatisfiable = true;
+      continue;
+    }
+
+    value = tvt(!l.sign());
+
+    // the units are added back to the simplified formula
+    for(const auto index : live_occurrences(l))
+      remove_clause(index);
+
+    const std::vector<std::size_t> falsified = live_occurrences(!l);
+    for(const auto index : falsified)
+    {
+      remove_literal(index, !l);
+      if(clauses[index].size() == 1)
+        queue.push_back(clauses[index].front());
+    }
+  }
+}
+
+void cnf_preprocessort::substitute_equivalent_literals()
+{
+  // the binary implication graph: a clause a+b yields !a -> b and !b -> a
+  const std::size_t no_literals = 2 * no_variables;
+  std::vector<std::vector<unsigned>> successors(no_literals);
+
+  for(std::size_t i = 0; i < clauses.size(); ++i)
+  {
+    if(removed[i] || clauses[i].size() != 2)
+      continue;
+
+    const literalt a = clauses[i][0];
+    const literalt b = clauses[i][1];
+    successors[(!a).get()].push_back(b.get());
+    successors[(!b).get()].push_back(a.get());
+  }
+
+  // Tarjan's algorithm, iteratively, to find the strongly connected
+  // components, whose literals are all equivalent
+  const std::size_t unvisited = std::numeric_limits<std::size_t>::max();
+  std::vector<std::size_t> index(no_literals, unvisited);
+  std::vector<std::size_t> lowlink(no_literals, 0);
+  std::vector<bool> on_stack(no_literals, false);
+  std::vector<unsigned> stack;
+  std::vector<std::pair<unsigned, std::size_t>> call_stack;
+  std::size_t next_index = 0;
+
+  // the literal that each substituted variable is replaced by
+  std::vector<literalt> substitution(no_variables);
+  std::vector<bool> substituted(no_variables, false);
+  bool has_substitutions = false;
+
+  for(unsigned root = 0; root < no_literals && !unsatisfiable; ++root)
+  {
+    if(index[root] != unvisited || successors[root].empty())
+      continue;
+
+    call_stack.emplace_back(root, 0);
+
+    while(!call_stack.empty())
+    {
+      const unsigned node = call_stack.back().first;
+      std::size_t &edge = call_stack.back().second;
+
+      if(edge == 0 && index[node] == unvisited)
+      {
+        index[node] = lowlink[node] = next_index++;
+        stack.push_back(node);
+        on_stack[node] = true;
+      }
+
+      if(edge < successors[node].size())
+      {
+        const unsigned successor = successors[node][edge++];
+        if(index[successor] == unvisited)
+          call_stack.emplace_back(successor, 0);
+        else if(on_stack[successor])
+          lowlink[node] = std::min(lowlink[node], index[successor]);
+        continue;
+      }
+
+      call_stack.pop_back();
+      if(!call_stack.empty())
+      {
+        const unsigned parent = call_stack.back().first;
+        lowlink[parent] = std::min(lowlink[parent], lowlink[node]);
+      }
+
+      if(lowlink[node] != index[node])
+        continue;
+
+      std::vector<literalt> component;
+      unsigned member;
+      do
+      {
+        member = stack.back();
+        stack.pop_back();
+        on_stack[member] = false;
+        literalt l;
+        l.set(member);
+        component.push_back(l);
+      } while(member != node);
+
+      if(component.size() < 2)
+        continue;
+
+      std::sort(component.begin(), component.end());
+
+      // Pick a frozen variable as representative if there is one, else the
+      // smallest. The component of the negated literals then picks the
+      // same variable, negated.
+      literalt representative = component.front();
+      for(const auto l : component)
+      {
+        if(frozen[l.var_no()])
+        {
+          representative = l;
+          break;
+        }
+      }
+
+      for(std::size_t i = 1; i < component.size(); ++i)
+      {
+        if(component[i - 1] == !component[i])
+          unsatisfiable = true;
+      }
+
+      for(const auto l : component)
+      {
+        const unsigned var = l.var_no();
+        if(l == representative || !is_eliminable(var) || substituted[var])
+          continue;
+
+        // l == representative, hence var == representative ^ sign(l)
+        substitution[var] = representative ^ l.sign();
+        substituted[var] = true;
+        has_substitutions = true;
+      }
+    }
+  }
+
+  if(unsatisfiable || !has_substitutions)
+    return;
+
+  for(unsigned var = 1; var < no_variables; ++var)
+  {
+    if(!substituted[var])
+      continue;
+
+    const literalt l(var, false);
+    reconstruction_stack.emplace_back(l, bvt{l, !substitution[var]});
+    reconstruction_stack.emplace_back(!l, bvt{!l, substitution[var]});
+    eliminated[var] = true;
+    ++substituted_variables;
+  }
+
+  const std::size_t number_of_clauses = clauses.size();
+  for(std::size_t i = 0; i < number_of_clauses; ++i)
+  {
+    if(removed[i])
+      continue;
+
+    bool changed = false;
+    bvt clause = clauses[i];
+    for(auto &l : clause)
+    {
+      if(substituted[l.var_no()])
+      {
+        l = substitution[l.var_no()] ^ l.sign();
+        changed = true;
+      }
+    }
+
+    if(changed)
+    {
+      remove_clause(i);
+      add_clause(std::move(clause));
+    }
+  }
+
+  propagate_units();
+}
+
+void cnf_preprocessort::subsume()
+{
+  std::vector<std::size_t> order;
+  for(std::size_t i = 0; i < clauses.size(); ++i)
+  {
+    if(!removed[i])
+      order.push_back(i);
+  }
+
+  std::stable_sort(
+    order.begin(), order.end(), [this](std::size_t a, std::size_t b) {
+      return clauses[a].size() < clauses[b].size();
+    });
+
+  std::vector<bool> marked(2 * no_variables, false);
+
+  // the number of literals of the given clause that are marked
+  auto count_marked = [&marked](const bvt &clause) {
+    std::size_t count = 0;
+    for(const auto l : clause)
+    {
+      if(marked[l.get()])
+        ++count;
+    }
+    return count;
+  };
+
+  for(const auto c : order)
+  {
+    if(removed[c] || unsatisfiable)
+      continue;
+
+    const bvt clause = clauses[c];
+
+    for(const auto l : clause)
+      marked[l.get()] = true;
+
+    // subsumption: check the clauses containing the rarest literal
+    literalt rarest = clause.front();
+    for(const auto l : clause)
+    {
+      if(live_occurrences(l).size() < live_occurrences(rarest).size())
+        rarest = l;
+    }
+
+    for(const auto d : live_occurrences(rarest))
+    {
+      if(
+        d != c && clauses[d].size() >= clause.size() &&
+        count_marked(clauses[d]) == clause.size())
+      {
+        remove_clause(d);
+        ++subsumed_clauses;
+      }
+    }
+
+    // self-subsuming resolution: if the clause with l negated is a subset
+    // of another clause, then !l can be removed from that clause
+    for(const auto l : clause)
+    {
+      const std::vector<std::size_t> candidates = live_occurrences(!l);
+      for(const auto d : candidates)
+      {
+        if(
+          d != c && clauses[d].size() >= clause.size() &&
+          count_marked(clauses[d]) == clause.size() - 1)
+        {
+          remove_literal(d, !l);
+          ++strengthened_clauses;
+        }
+      }
+    }
+
+    for(const auto l : clause)
+      marked[l.get()] = false;
+  }
+
+  propagate_units();
+}
+
+bool cnf_preprocessort::resolve(
+  const bvt &a,
+  const bvt &b,
+  literalt pivot,
+  bvt &dest) const
+{
+  dest.clear();
+  dest.reserve(a.size() + b.size() - 2);
+
+  for(const auto l : a)
+  {
+    if(l != pivot)
+      dest.push_back(l);
+  }
+
+  for(const auto l : b)
+  {
+    if(l != !pivot)
+      dest.push_back(l);
+  }
+
+  return !normalize(dest);
+}
+
+void cnf_preprocessort::eliminate_variables()
+{
+  std::vector<std::pair<std::size_t, unsigned>> candidates;
+
+  for(unsigned var = 1; var < no_variables; ++var)
+  {
+    if(!is_eliminable(var))
+      continue;
+
+    const std::size_t positive = live_occurrences(literalt(var, false)).size();
+    const std::size_t negative = live_occurrences(literalt(var, true)).size();
+
+    if(positive + negative != 0)
+      candidates.emplace_back(positive * negative, var);
+  }
+
+  // cheap variables first
+  std::sort(candidates.begin(), candidates.end());
+
+  std::vector<bvt> resolvents;
+  bvt resolvent;
+
+  for(const auto &candidate : candidates)
+  {
+    if(unsatisfiable)
+      return;
+
+    const unsigned var = candidate.second;
+    if(!is_eliminable(var))
+      continue;
+
+    const literalt pivot(var, false);
+    const std::vector<std::size_t> positive = live_occurrences(pivot);
+    const std::vector<std::size_t> negative = live_occurrences(!pivot);
+
+    if(
+      positive.size() > elimination_occurrence_limit ||
+      negative.size() > elimination_occurrence_limit)
+    {
+      continue;
+    }
+
+    // eliminate only if the formula does not grow
+    resolvents.clear();
+    bool bounded = true;
+
+    for(const auto a : positive)
+    {
+      for(const auto b : negative)
+      {
+        if(!resolve(clauses[a], clauses[b], pivot, resolvent))
+          continue;
+
+        if(
+          resolvent.size() > resolvent_length_limit ||
+          resolvents.size() == positive.size() + negative.size())
+        {
+          bounded = false;
+          break;
+        }
+
+        resolvents.push_back(resolvent);
+      }
+
+      if(!bounded)
+        break;
+    }
+
+    if(!bounded)
+      continue;
+
+    for(const auto a : positive)
+    {
+      reconstruction_stack.emplace_back(pivot, clauses[a]);
+      remove_clause(a);
+    }
+
+    for(const auto b : negative)
+    {
+      reconstruction_stack.emplace_back(!pivot, clauses[b]);
+      remove_clause(b);
+    }
+
+    eliminated[var] = true;
+    ++eliminated_variables;
+
+    for(auto &r : resolvents)
+      add_clause(std::move(r));
+  }
+
+  propagate_units();
+}
+
+void cnf_preprocessort::eliminate_blocked_clauses()
+{
+  std::vector<bool> marked(2 * no_variables, false);
+
+  for(std::size_t c = 0; c < clauses.size(); ++c)
+  {
+    if(removed[c])
+      continue;
+
+    const bvt &clause = clauses[c];
+
+    for(const auto l : clause)
+      marked[l.get()] = true;
+
+    // The clause is blocked on l if all resolvents on l are tautologies,
+    // i.e., each clause containing !l also contains the negation of another
+    // literal of the clause.
+    for(const auto l : clause)
+    {
+      if(!is_eliminable(l.var_no()))
+        continue;
+
+      const auto &candidates = live_occurrences(!l);
+      if(candidates.size() > elimination_occurrence_limit)
+        continue;
+
+      const bool blocked = std::all_of(
+        candidates.begin(), candidates.end(), [&](std::size_t d) {
+          return std::any_of(
+            clauses[d].begin(), clauses[d].end(), [&](literalt m) {
+              return m != !l && marked[(!m).get()];
+            });
+        });
+
+      if(blocked)
+      {
+        reconstruction_stack.emplace_back(l, clause);
+        remove_clause(c);
+        ++blocked_clauses;
+        break;
+      }
+    }
+
+    for(const auto l : clause)
+      marked[l.get()] = false;
+  }
+}
+
+bool cnf_preprocessort::operator()(std::vector<bvt> &input)
+{
+  const std::size_t input_size = input.size();
+
+  for(auto &clause : input)
+  {
+    for(const auto l : clause)
+    {
+      INVARIANT(
+        l.is_constant() || l.var_no() < no_variables,
+        "clauses must only contain known variables");
+    }
+
+    add_clause(std::move(clause));
+  }
+
+  input.clear();
+
+  propagate_units();
+
+  if(!unsatisfiable)
+    substitute_equivalent_literals();
+
+  if(!unsatisfiable)
+    subsume();
+
+  if(!unsatisfiable)
+    eliminate_variables();
+
+  if(!unsatisfiable)
+    eliminate_blocked_clauses();
+
+  if(unsatisfiable)
+  {
+    log.statistics() << "CNF preprocessing found the formula to be "
+                     << "unsatisfiable" << messaget::eom;
+    return false;
+  }
+
+  for(unsigned var = 1; var < no_variables; ++var)
+  {
+    if(!fixed[var].is_unknown())
+      input.push_back({literalt(var, fixed[var].is_false())});
+  }
+
+  for(std::size_t i = 0; i < clauses.size(); ++i)
+  {
+    if(!removed[i])
+      input.push_back(clauses[i]);
+  }
+
+  log.statistics() << "CNF preprocessing: " << input_size << " -> "
+                   << input.size() << " clauses, " << eliminated_variables
+                   << " variables eliminated, " << substituted_variables
+                   << " substituted, " << subsumed_clauses
+                   << " clauses subsumed, " << strengthened_clauses
+                   << " strengthened, " << blocked_clauses << " blocked"
+                   << messaget::eom;
+
+  return true;
+}
+
+void cnf_preprocessort::extend_assignment(std::vector<tvt> &assignment) const
+{
+  if(assignment.size() < no_variables)
+    assignment.resize(no_variables, tvt::unknown());
+
+  for(unsigned var = 1; var < no_variables; ++var)
+  {
+    if(eliminated[var])
+      assignment[var] = tvt(false);
+  }
+
+  auto is_true = [&assignment](literalt l) {
+    return assignment[l.var_no()].is_true() != l.sign() &&
+           !assignment[l.var_no()].is_unknown();
+  };
+
+  // replay the removed clauses, most recently removed first
+  for(auto it = reconstruction_stack.rbegin();
+      it != reconstruction_stack.rend();
+      ++it)
+  {
+    const bvt &clause = it->second;
+    if(std::none_of(clause.begin(), clause.end(), is_true))
+      assignment[it->first.var_no()] = tvt(!it->first.sign());
+  }
+}
@@ -0,0 +1,124 @@
+/*******************************************************************\
+
+Module: CNF Preprocessing
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// CNF Preprocessing
+
+#ifndef CPROVER_SOLVERS_SAT_CNF_PREPROCESSOR_H
+#define CPROVER_SOLVERS_SAT_CNF_PREPROCESSOR_H
+
+#include <utility>
+#include <vector>
+
+#include <util/message.h>
+#include <util/threeval.h>
+
+#include <solvers/prop/literal.h>
+
+/// Simplifies a CNF formula independently of a particular SAT solver,
+/// using
+///  * unit propagation,
+///  * equivalent literal substitution on the binary implication graph,
+///  * subsumption and self-subsuming resolution,
+///  * bounded variable elimination, and
+///  * blocked clause elimination.
+///
+/// The simplified formula is equisatisfiable with the original one.
+/// Frozen variables are never eliminated or substituted, so they may be used
+/// in assumptions when solving the simplified formula. A satisfying
+/// assignment of the simplified formula is turned into one of the original
+/// formula by \ref extend_assignment, which replays the removed clauses
+/// recorded on a reconstruction stack.
+class cnf_preprocessort
+{
+public:
+  /// \param no_variables: The number of variables, including the unused
+  ///   variable 0
+  /// \param message_handler: For reporting statistics
+  cnf_preprocessort(std::size_t no_variables, message_handlert &message_handler);
+
+  /// Prevents the variable of \p literal from being eliminated
+  void set_frozen(literalt literal);
+
+  /// Simplifies \p clauses in place
+  /// \return false if the formula has been found to be unsatisfiable
+  bool operator()(std::vector<bvt> &clauses);
+
+  /// Extends \p assignment, a satisfying assignment of the simplified
+  /// formula indexed by variable number, to the eliminated variables such
+  /// that it satisfies the original formula
+  void extend_assignment(std::vector<tvt> &assignment) const;
+
+  /// Number of occurrences of a literal on either side of a variable beyond
+  /// which the variable is not eliminated
+  std::size_t elimination_occurrence_limit = 16;
+
+  /// Maximum length of a resolvent added by variable elimination
+  std::size_t resolvent_length_limit = 24;
+
+protected:
+  messaget log;
+  std::size_t no_variables;
+
+  std::vector<bvt> clauses;
+  std::vector<bool> removed;
+
+  /// The indices of the clauses a literal occurs in, indexed by
+  /// `literalt::get()`; may contain removed clauses
+  std::vector<std::vector<std::size_t>> occurrences;
+
+  std::vector<bool> frozen;
+  std::vector<bool> eliminated;
+
+  /// Values of variables that are fixed by unit clauses
+  std::vector<tvt> fixed;
+
+  /// Removed clauses together with the literal to be made true if the
+  /// clause is falsified when extending an assignment
+  std::vector<std::pair<literalt, bvt>> reconstruction_stack;
+
+  /// Set when the empty clause has been derived
+  bool unsatisfiable;
+
+  std::size_t eliminated_variables;
+  std::size_t substituted_variables;
+  std::size_t subsumed_clauses;
+  std::size_t strengthened_clauses;
+  std::size_t blocked_clauses;
+
+  /// Sorts \p clause, removes duplicate and false literals
+  /// \return true if the clause is satisfied or a tautology
+  bool normalize(bvt &clause) const;
+
+  void add_clause(bvt clause);
+  void remove_clause(std::size_t index);
+  void remove_literal(std::size_t index, literalt literal);
+
+  /// Drops the removed clauses and those that no longer contain
+  /// \p literal from its occurrences
+  /// \return the indices of the clauses that contain \p literal
+  const std::vector<std::size_t> &live_occurrences(literalt literal);
+
+  bool is_eliminable(unsigned var) const
+  {
+    return !frozen[var] && !eliminated[var] && fixed[var].is_unknown();
+  }
+
+  void propagate_units();
+  void substitute_equivalent_literals();
+  void subsume();
+  void eliminate_variables();
+  void eliminate_blocked_clauses();
+
+  /// Computes the resolvent of \p a and \p b on the variable of
+  /// \p pivot, which occurs positively in \p a
+  /// \return false if the resolvent is a tautology
+  bool resolve(const bvt &a, const bvt &b, literalt pivot, bvt &dest) const;
+};
+
+#endif // CPROVER_SOLVERS_SAT_CNF_PREPROCESSOR_H
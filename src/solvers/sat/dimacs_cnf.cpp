@@ -12,7 +12,9 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/invariant.h>
 #include <util/magic.h>
 
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 dimacs_cnft::dimacs_cnft(message_handlert &message_handler)
@@ -102,3 +104,51 @@ void dimacs_cnf_dumpt::lcnf(const bvt &bv)
 {
   write_dimacs_clause(bv, out, true);
 }
+
+dimacs_cnf_streamt::dimacs_cnf_streamt(
+  std::ostream &_out,
+  message_handlert &message_handler)
+  : cnft(message_handler), out(_out), clause_count(0)
+{
+  problem_line_position = out.tellp();
+  write_problem_line();
+}
+
+/// Width of the counts in the problem line, enough for any std::size_t
+static const int problem_line_count_width =
+  std::numeric_limits<std::size_t>::digits10 + 1;
+
+void dimacs_cnf_streamt::write_problem_line()
+{
+  out.seekp(problem_line_position);
+
+  // We start counting at 1, thus there is one variable fewer.
+  // The counts are padded such that they can be rewritten in place.
+  out << "p cnf " << std::left << std::setw(problem_line_count_width)
+      << (no_variables() - 1) << ' ' << std::setw(problem_line_count_width)
+      << clause_count << std::right << "\n";
+
+  out.seekp(0, std::ios_base::end);
+}
+
+void dimacs_cnf_streamt::lcnf(const bvt &bv)
+{
+  bvt new_bv;
+
+  if(process_clause(bv, new_bv))
+    return;
+
+  write_dimacs_clause(new_bv, out, false);
+  ++clause_count;
+}
+
+void dimacs_cnf_streamt::set_assignment(literalt, bool)
+{
+  UNIMPLEMENTED;
+}
+
+bool dimacs_cnf_streamt::is_in_conflict(literalt) const
+{
+  UNREACHABLE;
+  return false;
+}
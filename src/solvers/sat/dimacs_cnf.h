@@ -71,4 +71,54 @@ protected:
   std::ostream &out;
 };
 
+/// Writes a DIMACS CNF file while the clauses are generated, such that they
+/// need not be kept in memory. The stream must be seekable: the problem
+/// line is written first with room for the counts, which are filled in
+/// by `write_problem_line` once all clauses have been added.
+class dimacs_cnf_streamt : public cnft
+{
+public:
+  dimacs_cnf_streamt(std::ostream &_out, message_handlert &message_handler);
+
+  const std::string solver_text() override
+  {
+    return "DIMACS CNF stream";
+  }
+
+  void lcnf(const bvt &bv) override;
+
+  tvt l_get(literalt) const override
+  {
+    return tvt::unknown();
+  }
+
+  size_t no_clauses() const override
+  {
+    return clause_count;
+  }
+
+  // dummy functions
+  void set_assignment(literalt a, bool value) override;
+  bool is_in_conflict(literalt l) const override;
+
+  /// Fills in the number of variables and clauses in the problem line and
+  /// moves back to the end of the stream, where comments may be added
+  void write_problem_line();
+
+  std::ostream &get_stream()
+  {
+    return out;
+  }
+
+protected:
+  resultt do_prop_solve() override
+  {
+    return resultt::P_ERROR;
+  }
+
+  std::ostream &out;
+  std::streampos problem_line_position;
+  std::size_t clause_count;
+};
+
 #endif // CPROVER_SOLVERS_SAT_DIMACS_CNF_H
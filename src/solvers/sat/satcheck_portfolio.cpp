@@ -0,0 +1,240 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Portfolio of SAT Solvers
+
+#include "satcheck_portfolio.h"
+
+#ifndef _WIN32
+#include <cerrno>
+
+#include <poll.h>
+#endif
+
+#include <util/exception_utils.h>
+#include <util/invariant.h>
+#include <util/make_unique.h>
+#include <util/worker_process.h>
+
+satcheck_portfoliot::satcheck_portfoliot(
+  std::vector<solver_configt> _solvers,
+  message_handlert &message_handler)
+  : cnf_clause_list_assignmentt(message_handler), solvers(std::move(_solvers))
+{
+  PRECONDITION(!solvers.empty());
+}
+
+const std::string satcheck_portfoliot::solver_text()
+{
+  std::string result = "portfolio of";
+
+  for(const auto &solver : solvers)
+    result += ' ' + solver.name;
+
+  return result;
+}
+
+void satcheck_portfoliot::set_assumptions(const bvt &_assumptions)
+{
+  assumptions = _assumptions;
+}
+
+void satcheck_portfoliot::set_assignment(literalt a, bool value)
+{
+  PRECONDITION(!a.is_constant());
+
+  const unsigned v = a.var_no();
+  if(v >= assignment.size())
+    assignment.resize(no_variables(), tvt::unknown());
+
+  assignment[v] = tvt(value != a.sign());
+}
+
+bool satcheck_portfoliot::is_in_conflict(literalt l) const
+{
+  for(std::size_t i = 0; i < assumptions.size() && i < conflict.size(); ++i)
+  {
+    if(conflict[i] && assumptions[i].var_no() == l.var_no())
+      return true;
+  }
+
+  return false;
+}
+
+std::string satcheck_portfoliot::solve_with(cnft &solver) const
+{
+  copy_to(solver);
+
+  // a preprocessing solver must not eliminate the variables we assume
+  for(const auto &assumption : assumptions)
+    solver.set_frozen(assumption);
+  solver.set_assumptions(assumptions);
+
+  std::string output;
+
+  switch(solver.prop_solve())
+  {
+  case resultt::P_SATISFIABLE:
+    output = 'S';
+    // we don't use variable 0, start with 1
+    for(std::size_t v = 1; v < _no_variables; ++v)
+    {
+      literalt l;
+      l.set(v, false);
+      const tvt value = solver.l_get(l);
+      output += value.is_true() ? 't' : value.is_false() ? 'f' : 'u';
+    }
+    break;
+
+  case resultt::P_UNSATISFIABLE:
+    output = 'U';
+    for(const auto &assumption : assumptions)
+    {
+      const bool in_conflict =
+        !assumption.is_constant() && solver.is_in_conflict(assumption);
+      output += in_conflict ? '1' : '0';
+    }
+    break;
+
+  case resultt::P_ERROR:
+    output = 'E';
+    break;
+  }
+
+  return output;
+}
+
+propt::resultt
+satcheck_portfoliot::read_result(const std::string &output)
+{
+  if(output.empty())
+    return resultt::P_ERROR;
+
+  if(output[0] == 'S')
+  {
+    assignment.assign(no_variables(), tvt::unknown());
+    for(std::size_t v = 1; v < output.size() && v < assignment.size(); ++v)
+    {
+      if(output[v] == 't')
+        assignment[v] = tvt(true);
+      else if(output[v] == 'f')
+        assignment[v] = tvt(false);
+    }
+
+    return resultt::P_SATISFIABLE;
+  }
+
+  if(output[0] == 'U')
+  {
+    conflict.assign(assumptions.size(), false);
+    for(std::size_t i = 1; i < output.size() && i <= conflict.size(); ++i)
+      conflict[i - 1] = output[i] == '1';
+
+    return resultt::P_UNSATISFIABLE;
+  }
+
+  return resultt::P_ERROR;
+}
+
+propt::resultt satcheck_portfoliot::do_prop_solve()
+{
+  assignment.clear();
+  conflict.clear();
+
+  log.statistics() << _no_variables - 1 << " variables, " << clauses.size()
+                   << " clauses" << messaget::eom;
+
+  null_message_handlert null_message_handler;
+
+  if(solvers.size() == 1 || !worker_processt::is_supported())
+  {
+    log.status() << "Solving with " << solvers.front().name << messaget::eom;
+    auto solver = solvers.front().make_solver(null_message_handler);
+    return read_result(solve_with(*solver));
+  }
+
+  log.status() << "Solving with " << solver_text() << messaget::eom;
+
+  std::vector<std::unique_ptr<worker_processt>> workers;
+  workers.reserve(solvers.size());
+
+  for(const auto &config : solvers)
+  {
+    try
+    {
+      workers.push_back(util_make_unique<worker_processt>([&]() {
+        auto solver = config.make_solver(null_message_handler);
+        return solve_with(*solver);
+      }));
+    }
+    catch(const system_exceptiont &e)
+    {
+      log.warning() << e.what() << messaget::eom;
+      workers.push_back(nullptr);
+    }
+  }
+
+#ifndef _WIN32
+  while(true)
+  {
+    std::vector<struct pollfd> pfds;
+    std::vector<std::size_t> indices;
+
+    for(std::size_t i = 0; i < workers.size(); ++i)
+    {
+      if(workers[i] == nullptr)
+        continue;
+
+      struct pollfd pfd;
+      pfd.fd = workers[i]->get_fd();
+      pfd.events = POLLIN;
+      pfd.revents = 0;
+      pfds.push_back(pfd);
+      indices.push_back(i);
+    }
+
+    if(pfds.empty())
+      break;
+
+    if(poll(pfds.data(), pfds.size(), -1) < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      break;
+    }
+
+    for(std::size_t j = 0; j < pfds.size(); ++j)
+    {
+      if(pfds[j].revents == 0)
+        continue;
+
+      const std::size_t i = indices[j];
+      const auto output = workers[i]->wait();
+      workers[i] = nullptr;
+
+      const resultt result =
+        output.has_value() ? read_result(*output) : resultt::P_ERROR;
+
+      if(result == resultt::P_ERROR)
+      {
+        log.warning() << solvers[i].name << " failed" << messaget::eom;
+        continue;
+      }
+
+      log.status() << solvers[i].name << " finished first" << messaget::eom;
+
+      // the destructors of the remaining workers terminate them
+      return result;
+    }
+  }
+#endif
+
+  log.error() << "all solvers in the portfolio failed" << messaget::eom;
+  return resultt::P_ERROR;
+}
@@ -0,0 +1,88 @@
+/*******************************************************************\
+
+Module: Portfolio of SAT Solvers
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Portfolio of SAT Solvers
+
+#ifndef CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
+#define CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cnf_clause_list.h"
+
+/// Collects the CNF and, when solving, races several SAT solvers on it,
+/// taking the answer of the first one to finish.
+///
+/// Each solver runs in a worker process that is forked from the current
+/// process and receives a copy of the clauses, see \ref worker_processt.
+/// The remaining workers are terminated as soon as one of them has returned
+/// an answer. Every call to `prop_solve` starts from scratch, i.e., no
+/// learnt clauses are retained between incremental calls.
+///
+/// Where worker processes are not supported, or there is only a single
+/// solver, the first solver is run in the current process.
+class satcheck_portfoliot : public cnf_clause_list_assignmentt
+{
+public:
+  using make_solvert =
+    std::function<std::unique_ptr<cnft>(message_handlert &)>;
+
+  struct solver_configt
+  {
+    std::string name;
+    make_solvert make_solver;
+  };
+
+  /// \param solvers: The solvers to race, must not be empty
+  /// \param message_handler: The message handler
+  satcheck_portfoliot(
+    std::vector<solver_configt> solvers,
+    message_handlert &message_handler);
+
+  const std::string solver_text() override;
+
+  void set_assumptions(const bvt &_assumptions) override;
+
+  bool has_set_assumptions() const override
+  {
+    return true;
+  }
+
+  void set_assignment(literalt a, bool value) override;
+
+  bool is_in_conflict(literalt l) const override;
+
+  bool has_is_in_conflict() const override
+  {
+    return true;
+  }
+
+protected:
+  resultt do_prop_solve() override;
+
+  /// Runs \p solver on the clauses and assumptions.
+  /// \return the result followed by the values of the variables if
+  ///   satisfiable, or by the assumptions in conflict if unsatisfiable
+  std::string solve_with(cnft &solver) const;
+
+  /// Reads the output of \ref solve_with into the assignment or the
+  /// conflict.
+  resultt read_result(const std::string &output);
+
+  std::vector<solver_configt> solvers;
+  bvt assumptions;
+
+  /// Whether the assumption at the same index was in the final conflict
+  std::vector<bool> conflict;
+};
+
+#endif // CPROVER_SOLVERS_SAT_SATCHECK_PORTFOLIO_H
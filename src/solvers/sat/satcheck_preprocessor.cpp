@@ -0,0 +1,119 @@
+/*******************************************************************\
+
+Module: SAT Solving with CNF Preprocessing
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// SAT Solving with CNF Preprocessing
+
+#include "satcheck_preprocessor.h"
+
+#include <util/invariant.h>
+
+#include "cnf_preprocessor.h"
+
+satcheck_preprocessort::satcheck_preprocessort(
+  make_solvert _make_solver,
+  message_handlert &message_handler)
+  : cnf_clause_list_assignmentt(message_handler),
+    make_solver(std::move(_make_solver))
+{
+  PRECONDITION(make_solver);
+}
+
+const std::string satcheck_preprocessort::solver_text()
+{
+  null_message_handlert null_message_handler;
+  return "CNF preprocessor with " +
+         make_solver(null_message_handler)->solver_text();
+}
+
+void satcheck_preprocessort::set_frozen(literalt literal)
+{
+  if(literal.is_constant())
+    return;
+
+  if(literal.var_no() >= frozen.size())
+    frozen.resize(literal.var_no() + 1, false);
+
+  frozen[literal.var_no()] = true;
+}
+
+void satcheck_preprocessort::set_assumptions(const bvt &_assumptions)
+{
+  assumptions = _assumptions;
+}
+
+void satcheck_preprocessort::set_assignment(literalt a, bool value)
+{
+  PRECONDITION(!a.is_constant());
+
+  const unsigned v = a.var_no();
+  if(v >= assignment.size())
+    assignment.resize(no_variables(), tvt::unknown());
+
+  assignment[v] = tvt(value != a.sign());
+}
+
+bool satcheck_preprocessort::is_in_conflict(literalt l) const
+{
+  // no solver is run if preprocessing refutes the formula by itself
+  return solver != nullptr && solver->is_in_conflict(l);
+}
+
+propt::resultt satcheck_preprocessort::do_prop_solve()
+{
+  assignment.clear();
+  solver = nullptr;
+
+  log.statistics() << _no_variables - 1 << " variables, " << clauses.size()
+                   << " clauses" << messaget::eom;
+
+  cnf_preprocessort preprocessor(_no_variables, log.get_message_handler());
+
+  for(std::size_t v = 0; v < frozen.size() && v < _no_variables; ++v)
+  {
+    if(frozen[v])
+      preprocessor.set_frozen(literalt(v, false));
+  }
+
+  for(const auto &assumption : assumptions)
+    preprocessor.set_frozen(assumption);
+
+  std::vector<bvt> simplified(clauses.begin(), clauses.end());
+
+  if(!preprocessor(simplified))
+    return resultt::P_UNSATISFIABLE;
+
+  solver = make_solver(log.get_message_handler());
+  solver->set_no_variables(_no_variables);
+
+  for(const auto &clause : simplified)
+    solver->lcnf(clause);
+
+  for(const auto &assumption : assumptions)
+    solver->set_frozen(assumption);
+  solver->set_assumptions(assumptions);
+
+  const resultt result = solver->prop_solve();
+
+  if(result == resultt::P_SATISFIABLE)
+  {
+    assignment.assign(_no_variables, tvt::unknown());
+
+    // we don't use variable 0, start with 1
+    for(std::size_t v = 1; v < _no_variables; ++v)
+    {
+      literalt l;
+      l.set(v, false);
+      assignment[v] = solver->l_get(l);
+    }
+
+    preprocessor.extend_assignment(assignment);
+  }
+
+  return result;
+}
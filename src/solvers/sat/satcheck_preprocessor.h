@@ -0,0 +1,72 @@
+/*******************************************************************\
+
+Module: SAT Solving with CNF Preprocessing
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// SAT Solving with CNF Preprocessing
+
+#ifndef CPROVER_SOLVERS_SAT_SATCHECK_PREPROCESSOR_H
+#define CPROVER_SOLVERS_SAT_SATCHECK_PREPROCESSOR_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "cnf_clause_list.h"
+
+/// Collects the CNF and, when solving, simplifies it using
+/// \ref cnf_preprocessort before passing it to a SAT solver, which thus
+/// need not have a preprocessor of its own.
+///
+/// Literals that are frozen (see `set_frozen`) or used as assumptions are
+/// kept, and the values of eliminated variables are reconstructed from the
+/// model of the solver. Every call to `prop_solve` preprocesses the complete
+/// formula and starts a fresh solver, i.e., no learnt clauses are retained
+/// between incremental calls.
+class satcheck_preprocessort : public cnf_clause_list_assignmentt
+{
+public:
+  using make_solvert =
+    std::function<std::unique_ptr<cnft>(message_handlert &)>;
+
+  satcheck_preprocessort(
+    make_solvert make_solver,
+    message_handlert &message_handler);
+
+  const std::string solver_text() override;
+
+  void set_frozen(literalt literal) override;
+
+  void set_assumptions(const bvt &_assumptions) override;
+
+  bool has_set_assumptions() const override
+  {
+    return true;
+  }
+
+  void set_assignment(literalt a, bool value) override;
+
+  bool is_in_conflict(literalt l) const override;
+
+  bool has_is_in_conflict() const override
+  {
+    return true;
+  }
+
+protected:
+  resultt do_prop_solve() override;
+
+  make_solvert make_solver;
+
+  /// The solver of the most recent call to `prop_solve`
+  std::unique_ptr<cnft> solver;
+
+  bvt assumptions;
+  std::vector<bool> frozen;
+};
+
+#endif // CPROVER_SOLVERS_SAT_SATCHECK_PREPROCESSOR_H
@@ -203,7 +203,8 @@ void smt2_convt::write_footer(std::ostream &os)
 
 void smt2_convt::define_object_size(
   const irep_idt &id,
-  const exprt &expr)
+  const exprt &expr,
+  std::size_t first_object)
 {
   PRECONDITION(expr.id() == ID_object_size);
   const exprt &ptr = to_unary_expr(expr).op();
@@ -215,6 +216,12 @@ void smt2_convt::define_object_size(
 
   for(const auto &o : pointer_logic.objects)
   {
+    if(number < first_object)
+    {
+      ++number;
+      continue;
+    }
+
     const typet &type = o.type();
     auto size_expr = size_of_expr(type, ns);
     const auto object_size =
@@ -758,19 +765,29 @@ void smt2_convt::convert_literal(const literalt l)
 
 void smt2_convt::push()
 {
-  UNIMPLEMENTED;
+  // We create a new context literal.
+  const literalt context_literal = convert(symbol_exprt(
+    "smt2_convt::context$" + std::to_string(context_literal_counter++),
+    bool_typet()));
+
+  assumptions.push_back(literal_exprt(context_literal));
+  context_size_stack.push_back(1);
 }
 
 void smt2_convt::push(const std::vector<exprt> &_assumptions)
 {
-  INVARIANT(assumptions.empty(), "nested contexts are not supported");
-
-  assumptions = _assumptions;
+  // We push the given assumptions as a single context onto the stack.
+  assumptions.insert(
+    assumptions.end(), _assumptions.begin(), _assumptions.end());
+  context_size_stack.push_back(_assumptions.size());
 }
 
 void smt2_convt::pop()
 {
-  assumptions.clear();
+  PRECONDITION(!context_size_stack.empty());
+
+  assumptions.resize(assumptions.size() - context_size_stack.back());
+  context_size_stack.pop_back();
 }
 
 std::string smt2_convt::convert_identifier(const irep_idt &identifier)
@@ -4155,9 +4172,10 @@ void smt2_convt::set_to(const exprt &expr, bool value)
   out << "\n";
 
   // special treatment for "set_to(a=b, true)" where
-  // a is a new symbol
+  // a is a new symbol, unless in a child context, where
+  // the definition must not hold unconditionally
 
-  if(expr.id() == ID_equal && value)
+  if(expr.id() == ID_equal && value && assumptions.empty())
   {
     const equal_exprt &equal_expr=to_equal_expr(expr);
 
@@ -4201,6 +4219,14 @@ void smt2_convt::set_to(const exprt &expr, bool value)
   out << "; set_to " << (value?"true":"false") << "\n"
       << "(assert ";
 
+  // In a child context, we add context_literal ==> expr to the formula.
+  if(!assumptions.empty())
+  {
+    out << "(or ";
+    convert_literal(!to_literal_expr(assumptions.back()).get_literal());
+    out << " ";
+  }
+
   if(!value)
   {
     out << "(not ";
@@ -4210,6 +4236,9 @@ void smt2_convt::set_to(const exprt &expr, bool value)
   else
     convert_expr(prepared_expr);
 
+  if(!assumptions.empty())
+    out << ")"; // or
+
   out << ")" << "\n"; // assert
 
   return;
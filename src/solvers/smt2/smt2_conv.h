@@ -67,13 +67,16 @@ public:
   std::string decision_procedure_text() const override;
   void print_assignment(std::ostream &out) const override;
 
-  /// Unimplemented
+  /// Pushes a new context, guarded by a fresh context literal that is
+  /// assumed when solving; constraints added in the context are implied by
+  /// it. Definitions made in the context remain valid after `pop`, which is
+  /// why SMT-LIB's push and pop commands are not used.
   void push() override;
 
-  /// Currently, only implements a single stack element (no nested contexts)
+  /// Pushes a new context in which \p _assumptions are assumed when solving
   void push(const std::vector<exprt> &_assumptions) override;
 
-  /// Currently, only implements a single stack element (no nested contexts)
+  /// Removes the most recently pushed context
   void pop() override;
 
   std::size_t get_number_of_solver_calls() const override;
@@ -84,7 +87,11 @@ protected:
   std::string benchmark, notes, logic;
   solvert solver;
 
+  /// The assumptions and context literals of all contexts, innermost last
   std::vector<exprt> assumptions;
+  /// The number of elements each context contributes to `assumptions`
+  std::vector<std::size_t> context_size_stack;
+  std::size_t context_literal_counter = 0;
   boolbv_widtht boolbv_width;
 
   std::size_t number_of_solver_calls = 0;
@@ -186,7 +193,12 @@ protected:
   void convert_address_of_rec(
     const exprt &expr, const pointer_typet &result_type);
 
-  void define_object_size(const irep_idt &id, const exprt &expr);
+  /// Asserts the size of the objects numbered \p first_object and above
+  /// for the object size expression \p expr that is named \p id
+  void define_object_size(
+    const irep_idt &id,
+    const exprt &expr,
+    std::size_t first_object = 0);
 
   // keeps track of all non-Boolean symbols and their value
   struct identifiert
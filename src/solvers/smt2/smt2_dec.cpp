@@ -9,13 +9,17 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "smt2_dec.h"
 
 #include <util/arith_tools.h>
+#include <util/exception_utils.h>
 #include <util/ieee_float.h>
 #include <util/invariant.h>
+#include <util/make_unique.h>
 #include <util/run.h>
 #include <util/std_expr.h>
 #include <util/std_types.h>
 #include <util/tempfile.h>
 
+#include <solvers/prop/literal_expr.h>
+
 #include "smt2irep.h"
 
 std::string smt2_dect::decision_procedure_text() const
@@ -36,18 +40,38 @@ std::string smt2_dect::decision_procedure_text() const
 
 decision_proceduret::resultt smt2_dect::dec_solve()
 {
+  if(
+    interactive && piped_processt::is_supported() &&
+    !interactive_command_line().empty())
+  {
+    return dec_solve_interactive();
+  }
+
   ++number_of_solver_calls;
 
+  if(time_limit_seconds > 0 && number_of_solver_calls == 1)
+  {
+    warning() << "the solver time limit is ignored unless the SMT2 solver "
+              << "runs interactively" << eom;
+  }
+
   temporary_filet temp_file_problem("smt2_dec_problem_", ""),
     temp_file_stdout("smt2_dec_stdout_", ""),
     temp_file_stderr("smt2_dec_stderr_", "");
 
   {
+    // The footer, which asserts the assumptions of the current contexts,
+    // is only valid for this call and hence removed from the stream again.
+    const auto formula_size = stringstream.tellp();
+    write_footer(stringstream);
+    const std::string problem = stringstream.str();
+    stringstream.str(problem.substr(0, formula_size));
+    stringstream.seekp(0, std::ios_base::end);
+
     // we write the problem into a file
     std::ofstream problem_out(
       temp_file_problem(), std::ios_base::out | std::ios_base::trunc);
-    problem_out << stringstream.str();
-    write_footer(problem_out);
+    problem_out << problem;
   }
 
   std::vector<std::string> argv;
@@ -130,15 +154,208 @@ decision_proceduret::resultt smt2_dect::dec_solve()
   return read_result(in);
 }
 
-decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
+std::vector<std::string> smt2_dect::interactive_command_line() const
 {
-  std::string line;
-  decision_proceduret::resultt res=resultt::D_ERROR;
+  switch(solver)
+  {
+  case solvert::CVC4:
+    return {"cvc4",
+            "-L",
+            "smt2",
+            "--incremental",
+            "--interactive",
+            "--no-interactive-prompt"};
+
+  case solvert::YICES:
+    return {"yices-smt2", "--incremental"};
+
+  case solvert::Z3:
+    return {"z3", "-in", "-smt2"};
+
+  case solvert::BOOLECTOR:
+  case solvert::CPROVER_SMT2:
+  case solvert::CVC3:
+  case solvert::MATHSAT:
+  case solvert::GENERIC:
+    break;
+  }
+
+  return {};
+}
+
+decision_proceduret::resultt
+smt2_dect::interactive_solver_failed(const std::string &message)
+{
+  error() << message << eom;
+  process.reset();
+  process_failed = true;
+  return resultt::D_ERROR;
+}
+
+decision_proceduret::resultt smt2_dect::dec_solve_interactive()
+{
+  ++number_of_solver_calls;
+
+  if(process_failed)
+  {
+    error() << "SMT2 solver is no longer running" << eom;
+    return resultt::D_ERROR;
+  }
+
+  if(!process)
+  {
+    try
+    {
+      process = util_make_unique<piped_processt>(interactive_command_line());
+    }
+    catch(const system_exceptiont &e)
+    {
+      error() << "error running SMT2 solver: " << e.what() << eom;
+      return resultt::D_ERROR;
+    }
+  }
+
+  // the assumptions only hold for this call
+  std::vector<literalt> assumption_literals;
+  for(const auto &assumption : assumptions)
+  {
+    const literalt l = to_literal_expr(assumption).get_literal();
+    if(l.is_false())
+      return resultt::D_UNSATISFIABLE;
+    if(!l.is_true())
+      assumption_literals.push_back(l);
+  }
+
+  // fix up the object sizes: the solver already has the sizes sent in
+  // previous calls, only new object size expressions and new objects are
+  // missing
+  for(const auto &object : object_sizes)
+  {
+    std::size_t &objects_defined = object_sizes_defined[object.second];
+    define_object_size(object.second, object.first, objects_defined);
+    objects_defined = pointer_logic.objects.size();
+  }
+
+  if(assumption_literals.empty())
+    out << "(check-sat)\n";
+  else
+  {
+    out << "(check-sat-assuming (";
+    for(const auto &l : assumption_literals)
+    {
+      out << ' ';
+      convert_literal(l);
+    }
+    out << "))\n";
+  }
+
+  // only send what has been added since the previous call
+  const bool sent = process->send(stringstream.str());
+  stringstream.str("");
 
+  if(!sent)
+    return interactive_solver_failed("SMT2 solver terminated unexpectedly");
+
+  if(
+    time_limit_seconds > 0 &&
+    !process->wait_for_output(std::chrono::seconds(time_limit_seconds)))
+  {
+    return interactive_solver_failed("SMT2 solver time limit exceeded");
+  }
+
+  auto parsed_opt = smt2irep(process->output(), get_message_handler());
+
+  if(!parsed_opt.has_value())
+    return interactive_solver_failed("SMT2 solver terminated unexpectedly");
+
+  if(parsed_opt->id() == "unsat")
+    return resultt::D_UNSATISFIABLE;
+
+  if(parsed_opt->id() != "sat")
+  {
+    const irept &parsed = *parsed_opt;
+    if(
+      parsed.id().empty() && parsed.get_sub().size() == 2 &&
+      parsed.get_sub().front().id() == "error")
+    {
+      error() << "SMT2 solver returned error message:\n"
+              << "\t\"" << parsed.get_sub()[1].id() << "\"" << eom;
+    }
+    else
+      error() << "SMT2 solver returned " << parsed.id() << eom;
+
+    return resultt::D_ERROR;
+  }
+
+  std::string get_values;
+  for(const auto &id : smt2_identifiers)
+    get_values += "(get-value (|" + id2string(id) + "|))\n";
+
+  if(!process->send(get_values))
+    return interactive_solver_failed("SMT2 solver terminated unexpectedly");
+
+  valuest values;
+
+  for(std::size_t i = 0; i < smt2_identifiers.size(); ++i)
+  {
+    parsed_opt = smt2irep(process->output(), get_message_handler());
+
+    if(!parsed_opt.has_value() || !read_value(*parsed_opt, values))
+      return interactive_solver_failed("SMT2 solver did not return a model");
+  }
+
+  set_values(values);
+
+  return resultt::D_SATISFIABLE;
+}
+
+bool smt2_dect::read_value(const irept &parsed, valuest &values)
+{
+  if(
+    parsed.id().empty() && parsed.get_sub().size() == 1 &&
+    parsed.get_sub().front().get_sub().size() == 2)
+  {
+    const irept &s0 = parsed.get_sub().front().get_sub()[0];
+    const irept &s1 = parsed.get_sub().front().get_sub()[1];
+
+    // Examples:
+    // ( (B0 true) )
+    // ( (|__CPROVER_pipe_count#1| (_ bv0 32)) )
+    // ( (|some_integer| 0) )
+    // ( (|some_integer| (- 10)) )
+
+    values[s0.id()] = s1;
+    return true;
+  }
+
+  return false;
+}
+
+void smt2_dect::set_values(valuest &values)
+{
   boolean_assignment.clear();
   boolean_assignment.resize(no_boolean_variables, false);
 
-  typedef std::unordered_map<irep_idt, irept> valuest;
+  for(auto &assignment : identifier_map)
+  {
+    std::string conv_id=convert_identifier(assignment.first);
+    const irept &value=values[conv_id];
+    assignment.second.value=parse_rec(value, assignment.second.type);
+  }
+
+  // Booleans
+  for(unsigned v=0; v<no_boolean_variables; v++)
+  {
+    const irept &value=values["B"+std::to_string(v)];
+    boolean_assignment[v]=(value.id()==ID_true);
+  }
+}
+
+decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
+{
+  std::string line;
+  decision_proceduret::resultt res=resultt::D_ERROR;
+
   valuest values;
 
   while(in)
@@ -154,20 +371,8 @@ decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
       res=resultt::D_SATISFIABLE;
     else if(parsed.id()=="unsat")
       res=resultt::D_UNSATISFIABLE;
-    else if(
-      parsed.id().empty() && parsed.get_sub().size() == 1 &&
-      parsed.get_sub().front().get_sub().size() == 2)
+    else if(read_value(parsed, values))
     {
-      const irept &s0=parsed.get_sub().front().get_sub()[0];
-      const irept &s1=parsed.get_sub().front().get_sub()[1];
-
-      // Examples:
-      // ( (B0 true) )
-      // ( (|__CPROVER_pipe_count#1| (_ bv0 32)) )
-      // ( (|some_integer| 0) )
-      // ( (|some_integer| (- 10)) )
-
-      values[s0.id()]=s1;
     }
     else if(
       parsed.id().empty() && parsed.get_sub().size() == 2 &&
@@ -184,19 +389,7 @@ decision_proceduret::resultt smt2_dect::read_result(std::istream &in)
     }
   }
 
-  for(auto &assignment : identifier_map)
-  {
-    std::string conv_id=convert_identifier(assignment.first);
-    const irept &value=values[conv_id];
-    assignment.second.value=parse_rec(value, assignment.second.type);
-  }
-
-  // Booleans
-  for(unsigned v=0; v<no_boolean_variables; v++)
-  {
-    const irept &value=values["B"+std::to_string(v)];
-    boolean_assignment[v]=(value.id()==ID_true);
-  }
+  set_values(values);
 
   return res;
 }
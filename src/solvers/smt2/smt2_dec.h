@@ -13,8 +13,13 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "smt2_conv.h"
 
 #include <util/message.h>
+#include <util/piped_process.h>
+
+#include <solvers/prop/solver_resource_limits.h>
 
 #include <fstream>
+#include <memory>
+#include <unordered_map>
 
 class smt2_stringstreamt
 {
@@ -26,6 +31,7 @@ protected:
 */
 class smt2_dect : protected smt2_stringstreamt,
                   public smt2_convt,
+                  public solver_resource_limitst,
                   public messaget
 {
 public:
@@ -42,8 +48,51 @@ public:
   resultt dec_solve() override;
   std::string decision_procedure_text() const override;
 
+  /// The limit is only enforced when the solver is run interactively: an
+  /// interactive solver that has not answered in time is terminated.
+  void set_time_limit_seconds(uint32_t lim) override
+  {
+    time_limit_seconds = lim;
+  }
+
+  /// If set, the solver is started once and kept running, and each call
+  /// to `dec_solve` only sends the formula added since the previous call.
+  /// Solvers without an interactive mode, and platforms without support
+  /// for piped processes, fall back to one solver run per call.
+  bool interactive = false;
+
 protected:
   resultt read_result(std::istream &in);
+
+  typedef std::unordered_map<irep_idt, irept> valuest;
+
+  /// Records \p parsed in \p values if it is the reply to a `get-value`
+  /// command.
+  /// \return true if \p parsed is such a reply
+  static bool read_value(const irept &parsed, valuest &values);
+
+  /// Sets the values of the identifiers and the Boolean variables
+  void set_values(valuest &values);
+
+  /// \return the command line of the solver in interactive mode, or an
+  ///   empty vector if the solver has none
+  std::vector<std::string> interactive_command_line() const;
+
+  resultt dec_solve_interactive();
+
+  /// Terminates the interactive solver after it has failed. It is not
+  /// restarted, as the formula sent to it so far would be missing.
+  resultt interactive_solver_failed(const std::string &message);
+
+  std::unique_ptr<piped_processt> process;
+  bool process_failed = false;
+
+  /// For each object size expression, the number of objects whose size has
+  /// been sent to the interactive solver
+  std::unordered_map<irep_idt, std::size_t> object_sizes_defined;
+
+  /// Time limit for each solver call in seconds, 0 for no limit
+  uint32_t time_limit_seconds = 0;
 };
 
 #endif // CPROVER_SOLVERS_SMT2_SMT2_DEC_H
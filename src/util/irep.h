@@ -21,6 +21,16 @@ Author: Daniel Kroening, kroening@kroening.com
 #  define HASH_CODE 1
 #endif
 // #define NAMED_SUB_IS_FORWARD_LIST
+// #define IREP_THREAD_SAFE
+// #define IREP_POOL_ALLOCATOR
+
+#ifdef IREP_THREAD_SAFE
+#  include <atomic>
+#endif
+
+#ifdef IREP_POOL_ALLOCATOR
+#  include "pool_allocator.h"
+#endif
 
 #ifdef NAMED_SUB_IS_FORWARD_LIST
 #  include "forward_list_as_map.h"
@@ -90,10 +100,47 @@ struct ref_count_ift
 {
 };
 
+#ifdef IREP_THREAD_SAFE
+/// A std::atomic that can be copied, such that tree nodes that contain it
+/// remain copyable. Copying is not atomic with respect to the source, which
+/// is fine for reference counts (a copied node gets its own count, see
+/// \ref sharing_treet::detach) and cached hash codes.
+template <typename T>
+class copyable_atomict : public std::atomic<T>
+{
+public:
+  // NOLINTNEXTLINE(runtime/explicit)
+  copyable_atomict(T value) : std::atomic<T>(value)
+  {
+  }
+
+  copyable_atomict(const copyable_atomict &other)
+    : std::atomic<T>(other.load(std::memory_order_relaxed))
+  {
+  }
+
+  copyable_atomict &operator=(const copyable_atomict &other)
+  {
+    this->store(other.load(std::memory_order_relaxed));
+    return *this;
+  }
+
+  copyable_atomict &operator=(T value)
+  {
+    this->store(value);
+    return *this;
+  }
+};
+#endif
+
 template <>
 struct ref_count_ift<true>
 {
+#ifdef IREP_THREAD_SAFE
+  copyable_atomict<unsigned> ref_count{1};
+#else
   unsigned ref_count = 1;
+#endif
 };
 
 /// A node with data in a tree, it contains:
@@ -115,6 +162,13 @@ struct ref_count_ift<true>
 ///
 /// * \c hash_code : if HASH_CODE is activated, this is used to cache the
 ///   result of the hash function.
+///
+/// If IREP_THREAD_SAFE is defined, the reference count and the hash code are
+/// atomic, such that ireps may be shared between threads. Note that this
+/// does not make writing to the same irept from several threads safe.
+///
+/// If IREP_POOL_ALLOCATOR is defined, nodes are allocated from a
+/// \ref fixed_size_poolt rather than individually using `operator new`.
 template <typename treet, typename named_subtreest, bool sharing = true>
 class tree_nodet : public ref_count_ift<sharing>
 {
@@ -136,7 +190,11 @@ public:
   subt sub;
 
 #if HASH_CODE
+#  ifdef IREP_THREAD_SAFE
+  mutable copyable_atomict<std::size_t> hash_code{0};
+#  else
   mutable std::size_t hash_code = 0;
+#  endif
 #endif
 
   void clear()
@@ -171,6 +229,22 @@ public:
       sub(std::move(_sub))
   {
   }
+
+#ifdef IREP_POOL_ALLOCATOR
+  // tree_nodet is incomplete in the class body, hence the pool type is
+  // spelled out in the function bodies
+  static void *operator new(std::size_t size)
+  {
+    PRECONDITION(size == sizeof(tree_nodet));
+    return fixed_size_poolt<sizeof(tree_nodet), alignof(tree_nodet)>::
+      allocate();
+  }
+
+  static void operator delete(void *p)
+  {
+    fixed_size_poolt<sizeof(tree_nodet), alignof(tree_nodet)>::deallocate(p);
+  }
+#endif
 };
 
 /// Base class for tree-like data structures with sharing
@@ -586,8 +660,8 @@ void sharing_treet<derivedt, named_subtreest>::remove_ref(dt *old_data)
   std::cout << "R: " << old_data << " " << old_data->ref_count << '\n';
 #endif
 
-  old_data->ref_count--;
-  if(old_data->ref_count == 0)
+  // decrement and test in one go, as required for atomic reference counts
+  if(--old_data->ref_count == 0)
   {
 #ifdef IREP_DEBUG
     std::cout << "D: " << pretty() << '\n';
@@ -622,9 +696,8 @@ void sharing_treet<derivedt, named_subtreest>::nonrecursive_destructor(
       continue;
 
     INVARIANT(d->ref_count != 0, "All contents of the stack must be in use");
-    d->ref_count--;
 
-    if(d->ref_count == 0)
+    if(--d->ref_count == 0)
     {
       stack.reserve(
         stack.size() + std::distance(d->named_sub.begin(), d->named_sub.end()) +
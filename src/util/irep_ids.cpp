@@ -53,6 +53,11 @@ enum class idt:unsigned
 
 string_containert::string_containert()
 {
+#ifdef IREP_THREAD_SAFE
+  // enough blocks for all 'unsigned' string numbers
+  string_blocks.reset(new string_blockt[std::size_t(1) << (32 - block_bits)]);
+#endif
+
   // pre-allocate empty string -- this gets index 0
   get("");
 
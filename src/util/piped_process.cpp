@@ -0,0 +1,297 @@
+/*******************************************************************\
+
+Module: Interactive Child Processes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Interactive Child Processes
+
+#include "piped_process.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "exception_utils.h"
+#include "invariant.h"
+#include "signal_catcher.h"
+
+bool piped_processt::is_supported()
+{
+#ifdef _WIN32
+  return false;
+#else
+  return true;
+#endif
+}
+
+#ifdef _WIN32
+
+piped_processt::piped_processt(const std::vector<std::string> &)
+  : pid(-1), stdin_fd(-1), output_stream(&output_buffer)
+{
+  throw system_exceptiont("piped processes are not supported on Windows");
+}
+
+piped_processt::~piped_processt()
+{
+}
+
+bool piped_processt::send(const std::string &)
+{
+  return false;
+}
+
+bool piped_processt::wait_for_output(std::chrono::milliseconds)
+{
+  return false;
+}
+
+bool piped_processt::fd_streambuft::read_ahead()
+{
+  return false;
+}
+
+piped_processt::fd_streambuft::int_type
+piped_processt::fd_streambuft::underflow()
+{
+  return traits_type::eof();
+}
+
+#else
+
+piped_processt::piped_processt(const std::vector<std::string> &argv)
+  : pid(-1), stdin_fd(-1), output_stream(&output_buffer)
+{
+  PRECONDITION(!argv.empty());
+
+  int stdin_pipe[2], stdout_pipe[2];
+
+  if(pipe(stdin_pipe) != 0)
+  {
+    throw system_exceptiont(
+      std::string("failed to create pipe: ") + std::strerror(errno));
+  }
+
+  if(pipe(stdout_pipe) != 0)
+  {
+    close(stdin_pipe[0]);
+    close(stdin_pipe[1]);
+    throw system_exceptiont(
+      std::string("failed to create pipe: ") + std::strerror(errno));
+  }
+
+  // prepare the arguments before forking, the child must not allocate
+  std::vector<char *> c_argv;
+  for(const auto &arg : argv)
+    c_argv.push_back(const_cast<char *>(arg.c_str()));
+  c_argv.push_back(nullptr);
+
+  pid = fork();
+
+  if(pid == 0)
+  {
+    remove_signal_catcher();
+
+    dup2(stdin_pipe[0], STDIN_FILENO);
+    dup2(stdout_pipe[1], STDOUT_FILENO);
+
+    const int null_fd = open("/dev/null", O_WRONLY);
+    if(null_fd != -1)
+      dup2(null_fd, STDERR_FILENO);
+
+    close(stdin_pipe[0]);
+    close(stdin_pipe[1]);
+    close(stdout_pipe[0]);
+    close(stdout_pipe[1]);
+
+    execvp(c_argv[0], c_argv.data());
+
+    // only reached if the executable cannot be run, which the parent
+    // notices as end-of-file on the output
+    _exit(127);
+  }
+
+  close(stdin_pipe[0]);
+  close(stdout_pipe[1]);
+
+  if(pid < 0)
+  {
+    close(stdin_pipe[1]);
+    close(stdout_pipe[0]);
+    throw system_exceptiont(
+      std::string("failed to start ") + argv.front() + ": " +
+      std::strerror(errno));
+  }
+
+  // don't leak the pipes into other children
+  fcntl(stdin_pipe[1], F_SETFD, FD_CLOEXEC);
+  fcntl(stdout_pipe[0], F_SETFD, FD_CLOEXEC);
+
+  // writes must not block, see send
+  fcntl(stdin_pipe[1], F_SETFL, fcntl(stdin_pipe[1], F_GETFL) | O_NONBLOCK);
+
+  stdin_fd = stdin_pipe[1];
+  output_buffer.fd = stdout_pipe[0];
+}
+
+piped_processt::~piped_processt()
+{
+  // most solvers terminate once their input is closed
+  if(stdin_fd != -1)
+    close(stdin_fd);
+
+  ::kill(pid, SIGTERM);
+
+  int status;
+  while(waitpid(pid, &status, 0) < 0 && errno == EINTR)
+  {
+  }
+
+  close(output_buffer.fd);
+}
+
+bool piped_processt::send(const std::string &data)
+{
+  if(stdin_fd == -1)
+    return false;
+
+  // writing to a process that has terminated must not kill us
+  struct sigaction ignore, old_action;
+  std::memset(&ignore, 0, sizeof(ignore));
+  ignore.sa_handler = SIG_IGN;
+  sigemptyset(&ignore.sa_mask);
+  sigaction(SIGPIPE, &ignore, &old_action);
+
+  // The process may stop reading its input until its output has been read,
+  // and the output may not be read before all data has been written.
+  // Hence read the output while waiting for the input to be accepted.
+  bool output_open = true;
+  std::size_t written = 0;
+  while(written < data.size())
+  {
+    struct pollfd fds[2];
+    fds[0].fd = stdin_fd;
+    fds[0].events = POLLOUT;
+    fds[1].fd = output_buffer.fd;
+    fds[1].events = POLLIN;
+
+    if(poll(fds, output_open ? 2 : 1, -1) < 0)
+    {
+      if(errno == EINTR)
+        continue;
+      break;
+    }
+
+    if(output_open && (fds[1].revents & (POLLIN | POLLHUP | POLLERR)) != 0)
+      output_open = output_buffer.read_ahead();
+
+    if((fds[0].revents & (POLLERR | POLLHUP | POLLNVAL)) != 0)
+      break;
+
+    if((fds[0].revents & POLLOUT) == 0)
+      continue;
+
+    const ssize_t n =
+      write(stdin_fd, data.data() + written, data.size() - written);
+    if(n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+      continue;
+    if(n <= 0)
+      break;
+    written += static_cast<std::size_t>(n);
+  }
+
+  sigaction(SIGPIPE, &old_action, nullptr);
+
+  if(written < data.size())
+  {
+    close(stdin_fd);
+    stdin_fd = -1;
+    return false;
+  }
+
+  return true;
+}
+
+bool piped_processt::wait_for_output(std::chrono::milliseconds timeout)
+{
+  if(output_buffer.has_buffered_data())
+    return true;
+
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  while(true)
+  {
+    const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      deadline - std::chrono::steady_clock::now());
+    if(remaining.count() < 0)
+      return false;
+
+    struct pollfd fds[1];
+    fds[0].fd = output_buffer.fd;
+    fds[0].events = POLLIN;
+
+    const int ready = poll(fds, 1, static_cast<int>(remaining.count()));
+    if(ready < 0 && errno == EINTR)
+      continue;
+
+    // an error is reported when reading
+    return ready != 0;
+  }
+}
+
+bool piped_processt::fd_streambuft::read_ahead()
+{
+  // the get area may still hold unread data from buffer
+  char data[4096];
+
+  ssize_t n;
+  do
+    n = read(fd, data, sizeof(data));
+  while(n < 0 && errno == EINTR);
+
+  if(n <= 0)
+    return false;
+
+  pending.append(data, static_cast<std::size_t>(n));
+  return true;
+}
+
+piped_processt::fd_streambuft::int_type
+piped_processt::fd_streambuft::underflow()
+{
+  if(gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+
+  if(!pending.empty())
+  {
+    current.swap(pending);
+    pending.clear();
+    setg(&current[0], &current[0], &current[0] + current.size());
+    return traits_type::to_int_type(*gptr());
+  }
+
+  ssize_t n;
+  do
+    n = read(fd, buffer, sizeof(buffer));
+  while(n < 0 && errno == EINTR);
+
+  if(n <= 0)
+    return traits_type::eof();
+
+  setg(buffer, buffer, buffer + n);
+  return traits_type::to_int_type(*gptr());
+}
+
+#endif
@@ -0,0 +1,101 @@
+/*******************************************************************\
+
+Module: Interactive Child Processes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Interactive Child Processes
+
+#ifndef CPROVER_UTIL_PIPED_PROCESS_H
+#define CPROVER_UTIL_PIPED_PROCESS_H
+
+#include <chrono>
+#include <istream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/// An executable that is started once and then kept running, such that
+/// several requests can be sent to its standard input and the replies read
+/// from its standard output, e.g., an SMT solver in interactive mode.
+/// Its standard error is discarded.
+///
+/// Piped processes are only supported on POSIX systems, see
+/// \ref piped_processt::is_supported.
+class piped_processt
+{
+public:
+  /// Starts the executable named by the first element of \p argv,
+  /// which is searched for in the PATH.
+  /// \throws system_exceptiont if the process cannot be created
+  explicit piped_processt(const std::vector<std::string> &argv);
+
+  piped_processt(const piped_processt &) = delete;
+  piped_processt &operator=(const piped_processt &) = delete;
+
+  /// Closes the standard input of the process and terminates it
+  ~piped_processt();
+
+  /// Writes \p data to the standard input of the process. Output that the
+  /// process produces meanwhile is read and kept for `output`, such that a
+  /// process that only accepts more input once its output is read cannot
+  /// block us.
+  /// \return false if the process no longer accepts input, e.g., because
+  ///   it has terminated or the executable could not be run
+  bool send(const std::string &data);
+
+  /// Waits until output of the process can be read without blocking, or
+  /// until it has terminated, but for no longer than \p timeout.
+  /// \return false if \p timeout has passed without output
+  bool wait_for_output(std::chrono::milliseconds timeout);
+
+  /// Returns the standard output of the process. Reading blocks until the
+  /// process produces output; end-of-file indicates that it has terminated.
+  std::istream &output()
+  {
+    return output_stream;
+  }
+
+  /// Returns true if piped processes are supported on this platform
+  static bool is_supported();
+
+protected:
+  /// Reads from a file descriptor
+  class fd_streambuft : public std::streambuf
+  {
+  public:
+    int fd = -1;
+
+    /// Reads what is available from the file descriptor, which must not
+    /// block, and keeps it until it is requested from the stream.
+    /// \return false on end-of-file or error
+    bool read_ahead();
+
+    /// \return true if data has been read that is yet to be requested
+    bool has_buffered_data() const
+    {
+      return gptr() < egptr() || !pending.empty();
+    }
+
+  protected:
+    int_type underflow() override;
+
+    char buffer[4096];
+
+    /// Data read by `read_ahead`, which follows that in the get area
+    std::string pending;
+
+    /// The get area when it holds data taken from `pending`
+    std::string current;
+  };
+
+  int pid;
+  int stdin_fd;
+  fd_streambuft output_buffer;
+  std::istream output_stream;
+};
+
+#endif // CPROVER_UTIL_PIPED_PROCESS_H
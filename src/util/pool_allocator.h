@@ -0,0 +1,205 @@
+/*******************************************************************\
+
+Module: Pool Allocator
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Pool Allocator
+
+#ifndef CPROVER_UTIL_POOL_ALLOCATOR_H
+#define CPROVER_UTIL_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <new>
+
+#ifdef IREP_THREAD_SAFE
+#  include <mutex>
+#  include <vector>
+#endif
+
+/// Allocates objects of a fixed size from large blocks. Freed objects are
+/// kept in a free list and reused by subsequent allocations, and the blocks
+/// are never returned to the operating system. This is much cheaper than
+/// `operator new` for large numbers of small objects that are allocated and
+/// freed frequently, such as the nodes of ireps, and places objects that are
+/// allocated together next to each other in memory.
+///
+/// With `IREP_THREAD_SAFE`, each thread has a free list of its own, which
+/// is used without locking. An object may be freed by another thread than
+/// the one that allocated it, so a thread that frees more objects than it
+/// allocates passes free objects on to a shared free list in batches, from
+/// which threads that run out of objects take them. A thread also passes on
+/// its free objects when it terminates.
+/// \tparam size: The size of the objects
+/// \tparam alignment: The alignment of the objects
+template <std::size_t size, std::size_t alignment>
+class fixed_size_poolt
+{
+  static_assert(
+    alignment <= alignof(std::max_align_t),
+    "blocks are allocated with operator new");
+
+public:
+  static void *allocate()
+  {
+    free_listt &free_list = get_free_list();
+
+    if(free_list.head == nullptr)
+      refill(free_list);
+
+    freet *result = free_list.head;
+    free_list.head = result->next;
+#ifdef IREP_THREAD_SAFE
+    --free_list.length;
+#endif
+    return result;
+  }
+
+  static void deallocate(void *p)
+  {
+    free_listt &free_list = get_free_list();
+
+    freet *object = static_cast<freet *>(p);
+    object->next = free_list.head;
+    free_list.head = object;
+#ifdef IREP_THREAD_SAFE
+    ++free_list.length;
+    if(free_list.length > 2 * objects_per_block)
+      share(free_list, objects_per_block);
+#endif
+  }
+
+private:
+  struct freet
+  {
+    freet *next;
+  };
+
+  static constexpr std::size_t unaligned_object_size =
+    size < sizeof(freet) ? sizeof(freet) : size;
+
+  static constexpr std::size_t object_size =
+    (unaligned_object_size + alignment - 1) / alignment * alignment;
+
+  // 64 KiB blocks, unless the objects are even larger
+  static constexpr std::size_t block_size = 1 << 16;
+  static constexpr std::size_t objects_per_block =
+    object_size < block_size ? block_size / object_size : 1;
+
+#ifdef IREP_THREAD_SAFE
+  struct free_listt
+  {
+    freet *head;
+    std::size_t length;
+  };
+
+  /// Free objects that any thread can take, as lists of up to
+  /// `objects_per_block` objects
+  struct shared_free_listt
+  {
+    std::mutex mutex;
+    std::vector<free_listt> batches;
+  };
+
+  static shared_free_listt &get_shared_free_list()
+  {
+    // never destroyed, as objects may be freed during static destruction
+    static shared_free_listt *shared_free_list = new shared_free_listt;
+    return *shared_free_list;
+  }
+
+  /// Moves the first \p count objects of \p free_list to the shared free list
+  static void share(free_listt &free_list, std::size_t count)
+  {
+    freet *last = free_list.head;
+    for(std::size_t i = 1; i < count; ++i)
+      last = last->next;
+
+    const free_listt batch{free_list.head, count};
+    free_list.head = last->next;
+    free_list.length -= count;
+    last->next = nullptr;
+
+    shared_free_listt &shared_free_list = get_shared_free_list();
+    std::lock_guard<std::mutex> lock(shared_free_list.mutex);
+    shared_free_list.batches.push_back(batch);
+  }
+
+  static void refill(free_listt &free_list)
+  {
+    {
+      shared_free_listt &shared_free_list = get_shared_free_list();
+      std::lock_guard<std::mutex> lock(shared_free_list.mutex);
+      if(!shared_free_list.batches.empty())
+      {
+        free_list = shared_free_list.batches.back();
+        shared_free_list.batches.pop_back();
+        return;
+      }
+    }
+
+    free_list.head = allocate_block();
+    free_list.length = objects_per_block;
+  }
+
+  /// Passes the free objects of a thread on to the shared free list when the
+  /// thread terminates
+  struct thread_exitt
+  {
+    free_listt &free_list;
+
+    ~thread_exitt()
+    {
+      if(free_list.length != 0)
+        share(free_list, free_list.length);
+    }
+  };
+
+  static free_listt &get_free_list()
+  {
+    // trivially destructible, such that objects can still be freed while
+    // the thread terminates
+    static thread_local free_listt free_list = {nullptr, 0};
+    static thread_local thread_exitt thread_exit{free_list};
+    return free_list;
+  }
+#else
+  struct free_listt
+  {
+    freet *head;
+  };
+
+  static void refill(free_listt &free_list)
+  {
+    free_list.head = allocate_block();
+  }
+
+  static free_listt &get_free_list()
+  {
+    static free_listt free_list = {nullptr};
+    return free_list;
+  }
+#endif
+
+  /// \return a free list of the objects in a new block
+  static freet *allocate_block()
+  {
+    char *block =
+      static_cast<char *>(::operator new(object_size * objects_per_block));
+
+    freet *free_list = nullptr;
+    for(std::size_t i = objects_per_block; i > 0; --i)
+    {
+      freet *object = reinterpret_cast<freet *>(block + (i - 1) * object_size);
+      object->next = free_list;
+      free_list = object;
+    }
+
+    return free_list;
+  }
+};
+
+#endif // CPROVER_UTIL_POOL_ALLOCATOR_H
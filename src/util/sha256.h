@@ -0,0 +1,52 @@
+/*******************************************************************\
+
+Module: SHA-256 Message Digest
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// SHA-256 Message Digest
+
+#ifndef CPROVER_UTIL_SHA256_H
+#define CPROVER_UTIL_SHA256_H
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+/// Computes the SHA-256 digest (FIPS 180-4) of a sequence of bytes that is
+/// passed in pieces using `update`.
+class sha256t
+{
+public:
+  sha256t();
+
+  void update(const void *data, std::size_t size);
+
+  void update(const std::string &data)
+  {
+    update(data.data(), data.size());
+  }
+
+  /// Completes the computation; `update` must not be called afterwards.
+  /// \return the 32 bytes of the digest
+  std::string digest();
+
+  /// \return the digest of \p data as 64 lower-case hexadecimal digits
+  static std::string hex_digest(const std::string &data);
+
+  /// \return the 64 lower-case hexadecimal digits of \p digest
+  static std::string to_hex(const std::string &digest);
+
+protected:
+  std::array<std::uint32_t, 8> state;
+  std::array<unsigned char, 64> block;
+  std::size_t block_size;
+  std::uint64_t total_size;
+
+  void process_block();
+};
+
+#endif // CPROVER_UTIL_SHA256_H
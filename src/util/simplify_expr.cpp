@@ -40,30 +40,6 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "simplify_expr_class.h"
 
-// #define USE_CACHE
-
-#ifdef USE_CACHE
-struct simplify_expr_cachet
-{
-public:
-  #if 1
-  typedef std::unordered_map<
-    exprt, exprt, irep_full_hash, irep_full_eq> containert;
-  #else
-  typedef std::unordered_map<exprt, exprt, irep_hash> containert;
-  #endif
-
-  containert container_normal;
-
-  containert &container()
-  {
-    return container_normal;
-  }
-};
-
-simplify_expr_cachet simplify_expr_cache;
-#endif
-
 simplify_exprt::resultt<> simplify_exprt::simplify_abs(const abs_exprt &expr)
 {
   if(expr.op().is_constant())
@@ -2602,24 +2578,23 @@ simplify_exprt::resultt<> simplify_exprt::simplify_node(exprt node)
 
 simplify_exprt::resultt<> simplify_exprt::simplify_rec(const exprt &expr)
 {
-  // look up in cache
-
-  #ifdef USE_CACHE
-  std::pair<simplify_expr_cachet::containert::iterator, bool>
-    cache_result=simplify_expr_cache.container().
-      insert(std::pair<exprt, exprt>(expr, exprt()));
+  // look up in cache; expressions without operands are cheap to simplify,
+  // and results without simplification of if-expressions differ
+  const bool use_cache =
+    cache != nullptr && do_simplify_if && expr.has_operands();
 
-  if(!cache_result.second) // found!
+  if(use_cache)
   {
-    const exprt &new_expr=cache_result.first->second;
+    auto cache_result = cache->find(expr);
 
-    if(new_expr.id().empty())
-      return true; // no change
+    if(cache_result.has_value())
+    {
+      if(!cache_result->changed)
+        return unchanged(expr);
 
-    expr=new_expr;
-    return false;
+      return std::move(cache_result->expr);
+    }
   }
-  #endif
 
   // We work on a copy to prevent unnecessary destruction of sharing.
   exprt tmp=expr;
@@ -2653,16 +2628,17 @@ simplify_exprt::resultt<> simplify_exprt::simplify_rec(const exprt &expr)
 
   if(no_change) // no change
   {
+    if(use_cache)
+      cache->insert(expr, {false, exprt()});
+
     return unchanged(expr);
   }
   else // change, new expression is 'tmp'
   {
     POSTCONDITION(as_const(tmp).type() == expr.type());
 
-#ifdef USE_CACHE
-    // save in cache
-    cache_result.first->second = tmp;
-#endif
+    if(use_cache)
+      cache->insert(expr, {true, tmp});
 
     return std::move(tmp);
   }
@@ -2700,3 +2676,17 @@ exprt simplify_expr(exprt src, const namespacet &ns)
   simplify_exprt(ns).simplify(src);
   return src;
 }
+
+bool simplify(exprt &expr, const namespacet &ns, simplify_expr_cachet &cache)
+{
+  return simplify_exprt(ns, cache).simplify(expr);
+}
+
+exprt simplify_expr(
+  exprt src,
+  const namespacet &ns,
+  simplify_expr_cachet &cache)
+{
+  simplify_exprt(ns, cache).simplify(src);
+  return src;
+}
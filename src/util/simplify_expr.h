@@ -14,6 +14,7 @@ class array_exprt;
 class exprt;
 class namespacet;
 class refined_string_exprt;
+class simplify_expr_cachet;
 
 #include <util/optional.h>
 
@@ -31,6 +32,15 @@ bool simplify(
 // this is the preferred interface
 exprt simplify_expr(exprt src, const namespacet &ns);
 
+/// Versions of the above that look up and record the results of simplifying
+/// subexpressions in \p cache, which must only be used with namespace \p ns
+bool simplify(exprt &expr, const namespacet &ns, simplify_expr_cachet &cache);
+
+exprt simplify_expr(
+  exprt src,
+  const namespacet &ns,
+  simplify_expr_cachet &cache);
+
 /// Get char sequence from content field of a refined string expression
 ///
 /// If `content` is of the form `&id[e]`, where `id` is an array-typed symbol
@@ -0,0 +1,61 @@
+/*******************************************************************\
+
+Module: Cache of Simplification Results
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache of Simplification Results
+
+#include "simplify_expr_cache.h"
+
+optionalt<simplify_expr_cachet::resultt>
+simplify_expr_cachet::find(const exprt &expr)
+{
+  const auto entry = index.find(expr);
+
+  if(entry == index.end())
+  {
+    ++misses;
+    return {};
+  }
+
+  ++hits;
+
+  // move to the front, keeping the iterator valid
+  entries.splice(entries.begin(), entries, entry->second);
+
+  return entry->second->second;
+}
+
+void simplify_expr_cachet::insert(const exprt &expr, resultt result)
+{
+  if(max_entries == 0)
+    return;
+
+  const auto entry = index.find(expr);
+  if(entry != index.end())
+  {
+    entry->second->second = std::move(result);
+    entries.splice(entries.begin(), entries, entry->second);
+    return;
+  }
+
+  if(entries.size() >= max_entries)
+  {
+    index.erase(entries.back().first);
+    entries.pop_back();
+    ++evictions;
+  }
+
+  entries.emplace_front(expr, std::move(result));
+  index.emplace(expr, entries.begin());
+}
+
+void simplify_expr_cachet::clear()
+{
+  index.clear();
+  entries.clear();
+}
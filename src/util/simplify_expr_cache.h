@@ -0,0 +1,81 @@
+/*******************************************************************\
+
+Module: Cache of Simplification Results
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Cache of Simplification Results
+
+#ifndef CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
+#define CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
+
+#include <list>
+#include <unordered_map>
+
+#include "expr.h"
+#include "optional.h"
+
+/// Maps expressions to the result of simplifying them, evicting the least
+/// recently used entry once the given number of entries is exceeded.
+///
+/// Expressions are compared including their comments, as the simplifier
+/// preserves those. The results depend on the namespace used for
+/// simplification, hence a cache must only be used with a single namespace,
+/// to which symbols may be added but which must not change otherwise.
+class simplify_expr_cachet
+{
+public:
+  /// \param max_entries: The maximum number of entries, 0 disables the cache
+  explicit simplify_expr_cachet(std::size_t max_entries)
+    : max_entries(max_entries)
+  {
+  }
+
+  struct resultt
+  {
+    bool changed;
+    exprt expr;
+  };
+
+  /// \return the cached result of simplifying \p expr, if any
+  optionalt<resultt> find(const exprt &expr);
+
+  /// Records that simplifying \p expr yields \p result
+  void insert(const exprt &expr, resultt result);
+
+  /// Removes all entries, but keeps the statistics
+  void clear();
+
+  bool is_enabled() const
+  {
+    return max_entries != 0;
+  }
+
+  std::size_t size() const
+  {
+    return entries.size();
+  }
+
+  std::size_t hits = 0;
+  std::size_t misses = 0;
+  std::size_t evictions = 0;
+
+protected:
+  std::size_t max_entries;
+
+  /// Most recently used entry first
+  using entriest = std::list<std::pair<exprt, resultt>>;
+  entriest entries;
+
+  std::unordered_map<
+    exprt,
+    entriest::iterator,
+    irep_hash, // cached in the nodes, unlike irep_full_hash
+    irep_full_eq>
+    index;
+};
+
+#endif // CPROVER_UTIL_SIMPLIFY_EXPR_CACHE_H
@@ -20,6 +20,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include "expr.h"
 #include "mp_arith.h"
 #include "nodiscard.h"
+#include "simplify_expr_cache.h"
 #include "type.h"
 // #define USE_LOCAL_REPLACE_MAP
 #ifdef USE_LOCAL_REPLACE_MAP
@@ -75,7 +76,8 @@ class simplify_exprt
 public:
   explicit simplify_exprt(const namespacet &_ns):
     do_simplify_if(true),
-    ns(_ns)
+    ns(_ns),
+    cache(nullptr)
 #ifdef DEBUG_ON_DEMAND
     , debug_on(false)
 #endif
@@ -86,6 +88,23 @@ public:
 #endif
   }
 
+  /// Looks up and records the results of simplifying expressions with
+  /// operands in \p _cache, which must only be used with namespace \p _ns
+  simplify_exprt(const namespacet &_ns, simplify_expr_cachet &_cache)
+    : do_simplify_if(true),
+      ns(_ns),
+      cache(_cache.is_enabled() ? &_cache : nullptr)
+#ifdef DEBUG_ON_DEMAND
+      ,
+      debug_on(false)
+#endif
+  {
+#ifdef DEBUG_ON_DEMAND
+    struct stat f;
+    debug_on=stat("SIMP_DEBUG", &f)==0;
+#endif
+  }
+
   virtual ~simplify_exprt()
   {
   }
@@ -244,6 +263,7 @@ public:
 
 protected:
   const namespacet &ns;
+  simplify_expr_cachet *cache;
 #ifdef DEBUG_ON_DEMAND
   bool debug_on;
 #endif
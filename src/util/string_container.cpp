@@ -29,6 +29,46 @@ string_containert::~string_containert()
 {
 }
 
+#ifdef IREP_THREAD_SAFE
+
+unsigned string_containert::get(const char *s)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return get_locked(string_ptrt(s));
+}
+
+unsigned string_containert::get(const std::string &s)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return get_locked(string_ptrt(s));
+}
+
+unsigned string_containert::get_locked(const string_ptrt &string_ptr)
+{
+  hash_tablet::iterator it=hash_table.find(string_ptr);
+
+  if(it!=hash_table.end())
+    return it->second;
+
+  size_t r=hash_table.size();
+
+  // these are stable
+  string_list.push_back(std::string(string_ptr.s, string_ptr.len));
+  string_ptrt result(string_list.back());
+
+  hash_table[result]=r;
+
+  // so are the blocks
+  string_blockt &block = string_blocks[r >> block_bits];
+  if(!block)
+    block = string_blockt(new std::string *[block_mask + 1]);
+  block[r & block_mask] = &string_list.back();
+
+  return r;
+}
+
+#else
+
 unsigned string_containert::get(const char *s)
 {
   string_ptrt string_ptr(s);
@@ -74,3 +114,5 @@ unsigned string_containert::get(const std::string &s)
 
   return r;
 }
+
+#endif
@@ -16,6 +16,11 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <unordered_map>
 #include <vector>
 
+#ifdef IREP_THREAD_SAFE
+#  include <memory>
+#  include <mutex>
+#endif
+
 #include "string_hash.h"
 
 struct string_ptrt
@@ -64,13 +69,17 @@ public:
   // the pointer is guaranteed to be stable
   const char *c_str(size_t no) const
   {
-    return string_vector[no]->c_str();
+    return get_string(no).c_str();
   }
 
   // the reference is guaranteed to be stable
   const std::string &get_string(size_t no) const
   {
+#ifdef IREP_THREAD_SAFE
+    return *string_blocks[no >> block_bits][no & block_mask];
+#else
     return *string_vector[no];
+#endif
   }
 
 protected:
@@ -85,8 +94,26 @@ protected:
   typedef std::list<std::string> string_listt;
   string_listt string_list;
 
+#ifdef IREP_THREAD_SAFE
+  /// Serialises adding strings; looking up a string by its number does not
+  /// require locking.
+  std::mutex mutex;
+
+  /// Returns the number of \p s, adding it if necessary;
+  /// requires `mutex` to be held
+  unsigned get_locked(const string_ptrt &s);
+
+  // The string pointers are stored in blocks that are never moved, such that
+  // other threads can look them up while new strings are added. A string
+  // number that a thread has obtained is always backed by a block.
+  static const std::size_t block_bits = 16;
+  static const std::size_t block_mask = (std::size_t(1) << block_bits) - 1;
+  typedef std::unique_ptr<std::string *[]> string_blockt;
+  std::unique_ptr<string_blockt[]> string_blocks;
+#else
   typedef std::vector<std::string *> string_vectort;
   string_vectort string_vector;
+#endif
 };
 
 /// Get a reference to the global string container.
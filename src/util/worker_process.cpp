@@ -0,0 +1,320 @@
+/*******************************************************************\
+
+Module: Worker Processes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Worker Processes
+
+#include "worker_process.h"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <iostream>
+
+#include "exception_utils.h"
+#include "invariant.h"
+
+bool worker_processt::is_supported()
+{
+#ifdef _WIN32
+  return false;
+#else
+  return true;
+#endif
+}
+
+#ifdef _WIN32
+
+worker_processt::worker_processt(const workt &) : pid(-1), fd(-1)
+{
+  throw system_exceptiont("worker processes are not supported on Windows");
+}
+
+worker_processt::~worker_processt()
+{
+}
+
+bool worker_processt::ready() const
+{
+  return true;
+}
+
+optionalt<std::string> worker_processt::wait()
+{
+  return {};
+}
+
+void worker_processt::kill()
+{
+}
+
+optionalt<std::size_t> wait_for_any_worker(
+  const std::vector<std::unique_ptr<worker_processt>> &workers)
+{
+  // no worker can have been created
+  for(std::size_t i = 0; i < workers.size(); ++i)
+  {
+    if(workers[i] != nullptr)
+      return i;
+  }
+
+  return {};
+}
+
+worker_slotst::worker_slotst(std::size_t) : read_fd(-1), write_fd(-1)
+{
+}
+
+worker_slotst::~worker_slotst()
+{
+}
+
+bool worker_slotst::try_acquire()
+{
+  return false;
+}
+
+void worker_slotst::release()
+{
+}
+
+#else
+
+/// Writes all of \p data to \p fd
+/// \return false if writing failed
+static bool write_all(int fd, const std::string &data)
+{
+  std::size_t written = 0;
+  while(written < data.size())
+  {
+    const ssize_t n = write(fd, data.data() + written, data.size() - written);
+    if(n < 0 && errno == EINTR)
+      continue;
+    if(n <= 0)
+      return false;
+    written += static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+worker_processt::worker_processt(const workt &work) : pid(-1), fd(-1)
+{
+  int pipefd[2];
+  if(pipe(pipefd) != 0)
+  {
+    throw system_exceptiont(
+      std::string("failed to create pipe: ") + std::strerror(errno));
+  }
+
+  // don't let the worker inherit (and later repeat) unflushed output
+  std::cout.flush();
+  std::cerr.flush();
+
+  pid = fork();
+
+  if(pid == 0)
+  {
+    // worker process: never return to the caller
+    close(pipefd[0]);
+
+    int exit_code = 1;
+    try
+    {
+      if(write_all(pipefd[1], work()))
+        exit_code = 0;
+    }
+    catch(...)
+    {
+    }
+
+    close(pipefd[1]);
+    _exit(exit_code);
+  }
+
+  close(pipefd[1]);
+
+  if(pid < 0)
+  {
+    close(pipefd[0]);
+    throw system_exceptiont(
+      std::string("failed to fork worker process: ") + std::strerror(errno));
+  }
+
+  fd = pipefd[0];
+}
+
+worker_processt::~worker_processt()
+{
+  if(fd != -1)
+  {
+    kill();
+    wait();
+  }
+}
+
+bool worker_processt::ready() const
+{
+  if(fd == -1)
+    return true;
+
+  struct pollfd pfd;
+  pfd.fd = fd;
+  pfd.events = POLLIN;
+  pfd.revents = 0;
+
+  return poll(&pfd, 1, 0) > 0;
+}
+
+optionalt<std::string> worker_processt::wait()
+{
+  PRECONDITION(fd != -1);
+
+  std::string data;
+  char buffer[4096];
+
+  while(true)
+  {
+    const ssize_t n = read(fd, buffer, sizeof(buffer));
+    if(n < 0 && errno == EINTR)
+      continue;
+    if(n <= 0)
+      break;
+    data.append(buffer, static_cast<std::size_t>(n));
+  }
+
+  close(fd);
+  fd = -1;
+
+  int status;
+  while(waitpid(pid, &status, 0) < 0)
+  {
+    if(errno != EINTR)
+      return {};
+  }
+
+  if(!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+    return {};
+
+  return std::move(data);
+}
+
+void worker_processt::kill()
+{
+  if(fd != -1)
+    ::kill(pid, SIGKILL);
+}
+
+optionalt<std::size_t> wait_for_any_worker(
+  const std::vector<std::unique_ptr<worker_processt>> &workers)
+{
+  std::vector<struct pollfd> pfds;
+  std::vector<std::size_t> indices;
+
+  for(std::size_t i = 0; i < workers.size(); ++i)
+  {
+    if(workers[i] == nullptr)
+      continue;
+
+    // a worker that has been waited for already is ready
+    if(workers[i]->get_fd() == -1)
+      return i;
+
+    struct pollfd pfd;
+    pfd.fd = workers[i]->get_fd();
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    pfds.push_back(pfd);
+    indices.push_back(i);
+  }
+
+  if(pfds.empty())
+    return {};
+
+  while(poll(pfds.data(), pfds.size(), -1) < 0)
+  {
+    // without poll, fall back to waiting for the first worker
+    if(errno != EINTR)
+      return indices.front();
+  }
+
+  for(std::size_t j = 0; j < pfds.size(); ++j)
+  {
+    if(pfds[j].revents != 0)
+      return indices[j];
+  }
+
+  UNREACHABLE;
+}
+
+worker_slotst::worker_slotst(std::size_t number_of_slots)
+  : read_fd(-1), write_fd(-1)
+{
+  int pipefd[2];
+  if(pipe(pipefd) != 0)
+  {
+    throw system_exceptiont(
+      std::string("failed to create pipe: ") + std::strerror(errno));
+  }
+
+  read_fd = pipefd[0];
+  write_fd = pipefd[1];
+
+  // taking a slot must not block when there is none
+  const int flags = fcntl(read_fd, F_GETFL);
+  if(flags == -1 || fcntl(read_fd, F_SETFL, flags | O_NONBLOCK) == -1)
+  {
+    close(read_fd);
+    close(write_fd);
+    throw system_exceptiont(
+      std::string("failed to configure pipe: ") + std::strerror(errno));
+  }
+
+  // each byte in the pipe is a free slot
+  if(!write_all(write_fd, std::string(number_of_slots, '+')))
+  {
+    close(read_fd);
+    close(write_fd);
+    throw system_exceptiont(
+      std::string("failed to fill pipe: ") + std::strerror(errno));
+  }
+}
+
+worker_slotst::~worker_slotst()
+{
+  close(read_fd);
+  close(write_fd);
+}
+
+bool worker_slotst::try_acquire()
+{
+  char slot;
+  while(true)
+  {
+    const ssize_t n = read(read_fd, &slot, 1);
+    if(n < 0 && errno == EINTR)
+      continue;
+    return n == 1;
+  }
+}
+
+void worker_slotst::release()
+{
+  const bool written = write_all(write_fd, "+");
+  CHECK_RETURN(written);
+}
+
+#endif
@@ -0,0 +1,117 @@
+/*******************************************************************\
+
+Module: Worker Processes
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Worker Processes
+
+#ifndef CPROVER_UTIL_WORKER_PROCESS_H
+#define CPROVER_UTIL_WORKER_PROCESS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "optional.h"
+
+/// A child process that is forked from the current process, runs a given
+/// function and passes the string returned by that function back to the
+/// parent process.
+///
+/// As the worker starts from a copy of the address space of its parent,
+/// it can operate on any data structure that has been set up before, e.g.,
+/// a formula that has already been passed to a solver. Changes made by the
+/// worker are not visible in the parent process. This is the means of
+/// parallelisation that is safe to use with ireps, which are not thread-safe.
+///
+/// Worker processes are only supported on POSIX systems, see
+/// \ref worker_processt::is_supported.
+class worker_processt
+{
+public:
+  using workt = std::function<std::string()>;
+
+  /// Forks a worker process that runs \p work and then terminates.
+  /// The function is not executed in the calling process.
+  /// \throws system_exceptiont if the process cannot be created
+  explicit worker_processt(const workt &work);
+
+  worker_processt(const worker_processt &) = delete;
+  worker_processt &operator=(const worker_processt &) = delete;
+
+  /// Terminates the worker if it is still running
+  ~worker_processt();
+
+  /// Returns true if the worker has finished sending its result (or has
+  /// died), i.e., `wait` will not block for long.
+  bool ready() const;
+
+  /// Waits for the worker to terminate.
+  /// \return the string returned by the work function, or an empty optional
+  ///   if the worker terminated abnormally (e.g., an exception was thrown,
+  ///   it was killed or it ran out of memory)
+  optionalt<std::string> wait();
+
+  /// Terminates the worker; `wait` will return an empty optional
+  void kill();
+
+  /// Returns the file descriptor the result of the worker is read from,
+  /// for use with `poll`, or -1 if the worker has been waited for already
+  int get_fd() const
+  {
+    return fd;
+  }
+
+  /// Returns true if worker processes are supported on this platform
+  static bool is_supported();
+
+protected:
+  int pid;
+  int fd;
+};
+
+/// Blocks until at least one of the non-null entries of \p workers is
+/// ready (see \ref worker_processt::ready), so that results can be
+/// collected in the order in which the workers finish.
+/// \return the index of a ready worker, or an empty optional if all entries
+///   of \p workers are null
+optionalt<std::size_t> wait_for_any_worker(
+  const std::vector<std::unique_ptr<worker_processt>> &workers);
+
+/// A pool of slots for worker processes that is shared by a process and all
+/// the worker processes forked from it, directly or indirectly, similar to
+/// the job server of GNU make. Any of these processes can start a worker
+/// whenever a slot is free, which lets busy processes pass work on to idle
+/// capacity wherever it becomes available.
+///
+/// On platforms without worker processes, no slot is ever available.
+class worker_slotst
+{
+public:
+  /// Creates a pool with \p number_of_slots free slots
+  /// \throws system_exceptiont if the pool cannot be created
+  explicit worker_slotst(std::size_t number_of_slots);
+
+  worker_slotst(const worker_slotst &) = delete;
+  worker_slotst &operator=(const worker_slotst &) = delete;
+
+  ~worker_slotst();
+
+  /// Takes a slot if one is free, without blocking
+  /// \return true if a slot has been taken
+  bool try_acquire();
+
+  /// Returns a slot taken by this or any other process sharing the pool
+  void release();
+
+protected:
+  int read_fd;
+  int write_fd;
+};
+
+#endif // CPROVER_UTIL_WORKER_PROCESS_H
@@ -0,0 +1,213 @@
+/*******************************************************************\
+
+Module: Unit tests for solver_result_cachet
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/file_util.h>
+#include <util/options.h>
+#include <util/symbol_table.h>
+#include <util/tempdir.h>
+
+#include <goto-checker/solver_result_cache.h>
+#include <goto-symex/symex_target_equation.h>
+
+/// Adds an assertion `x < limit` with the given property ID to \p equation
+static void add_assertion(
+  symex_target_equationt &equation,
+  goto_programt &goto_program,
+  const irep_idt &property_id,
+  const exprt &x,
+  const mp_integer &limit)
+{
+  source_locationt source_location;
+  source_location.set_property_id(property_id);
+  const exprt cond =
+    binary_relation_exprt(x, ID_lt, from_integer(limit, x.type()));
+  const auto pc =
+    goto_program.add(goto_programt::make_assertion(cond, source_location));
+
+  equation.assertion(
+    true_exprt(), cond, "assertion", symex_targett::sourcet("main", pc));
+}
+
+SCENARIO(
+  "solver result cache keys are stable",
+  "[core][goto-checker][solver_result_cache]")
+{
+  symbol_tablet symbol_table;
+  const namespacet ns(symbol_table);
+  optionst options;
+  goto_programt goto_program;
+
+  const signedbv_typet type(32);
+  symex_target_equationt equation(null_message_handler);
+  add_assertion(
+    equation,
+    goto_program,
+    "main.assertion.1",
+    symbol_exprt("x", type),
+    10);
+
+  const std::string key = solver_result_cache_key(equation, options, ns);
+
+  GIVEN("An equation")
+  {
+    THEN("The key is a SHA-256 digest")
+    {
+      REQUIRE(key.size() == 64);
+      REQUIRE(key.find_first_not_of("0123456789abcdef") == std::string::npos);
+    }
+  }
+
+  GIVEN("An equation that only differs in comments")
+  {
+    symex_target_equationt other_equation(null_message_handler);
+    symbol_exprt other_x("x", type);
+    other_x.add_source_location().set_line(42);
+    add_assertion(
+      other_equation, goto_program, "main.assertion.1", other_x, 10);
+
+    THEN("The keys are equal")
+    {
+      REQUIRE(solver_result_cache_key(other_equation, options, ns) == key);
+    }
+  }
+
+  GIVEN("An equation with a different assertion")
+  {
+    symex_target_equationt other_equation(null_message_handler);
+    add_assertion(
+      other_equation,
+      goto_program,
+      "main.assertion.1",
+      symbol_exprt("x", type),
+      11);
+
+    THEN("The keys differ")
+    {
+      REQUIRE(solver_result_cache_key(other_equation, options, ns) != key);
+    }
+  }
+
+  GIVEN("Different solver options")
+  {
+    options.set_option("refine-arrays", true);
+
+    THEN("The keys differ")
+    {
+      REQUIRE(solver_result_cache_key(equation, options, ns) != key);
+    }
+  }
+
+  GIVEN("Sliced steps")
+  {
+    symex_target_equationt other_equation(null_message_handler);
+    add_assertion(
+      other_equation,
+      goto_program,
+      "main.assertion.1",
+      symbol_exprt("x", type),
+      10);
+    add_assertion(
+      other_equation,
+      goto_program,
+      "main.assertion.2",
+      symbol_exprt("y", type),
+      5);
+    other_equation.SSA_steps.back().ignore = true;
+
+    THEN("They do not contribute to the key")
+    {
+      REQUIRE(solver_result_cache_key(other_equation, options, ns) == key);
+    }
+  }
+}
+
+SCENARIO(
+  "solver result cache stores proved properties",
+  "[core][goto-checker][solver_result_cache]")
+{
+  symbol_tablet symbol_table;
+  const namespacet ns(symbol_table);
+  optionst options;
+  goto_programt goto_program;
+  temp_dirt temp_dir("solver_result_cacheXXXXXX");
+
+  symex_target_equationt equation(null_message_handler);
+  const signedbv_typet type(32);
+  add_assertion(
+    equation,
+    goto_program,
+    "main.assertion.1",
+    symbol_exprt("x", type),
+    10);
+  add_assertion(
+    equation,
+    goto_program,
+    "main.assertion.2",
+    symbol_exprt("y", type),
+    5);
+
+  const auto pc = goto_program.instructions.begin();
+  auto make_properties = [&pc]() {
+    propertiest properties;
+    properties.emplace(
+      "main.assertion.1",
+      property_infot(pc, "assertion", property_statust::UNKNOWN));
+    properties.emplace(
+      "main.assertion.2",
+      property_infot(pc, "assertion", property_statust::UNKNOWN));
+    return properties;
+  };
+
+  const std::string directory = concat_dir_file(temp_dir.path, "cache");
+
+  GIVEN("An empty cache")
+  {
+    solver_result_cachet cache(
+      directory, equation, options, ns, null_message_handler);
+    propertiest properties = make_properties();
+    std::unordered_set<irep_idt> updated_properties;
+
+    THEN("No property is updated")
+    {
+      REQUIRE(cache.lookup(properties, updated_properties) == 0);
+      REQUIRE(updated_properties.empty());
+    }
+  }
+
+  GIVEN("A cache that records a proved and a refuted property")
+  {
+    {
+      solver_result_cachet cache(
+        directory, equation, options, ns, null_message_handler);
+      propertiest properties = make_properties();
+      properties.at("main.assertion.1").status = property_statust::PASS;
+      properties.at("main.assertion.2").status = property_statust::FAIL;
+      cache.store(properties);
+    }
+
+    solver_result_cachet cache(
+      directory, equation, options, ns, null_message_handler);
+    propertiest properties = make_properties();
+    std::unordered_set<irep_idt> updated_properties;
+
+    THEN("Only the proved property is taken from the cache")
+    {
+      REQUIRE(cache.lookup(properties, updated_properties) == 1);
+      REQUIRE(updated_properties.count("main.assertion.1") == 1);
+      REQUIRE(
+        properties.at("main.assertion.1").status == property_statust::PASS);
+      REQUIRE(
+        properties.at("main.assertion.2").status ==
+        property_statust::UNKNOWN);
+    }
+  }
+}
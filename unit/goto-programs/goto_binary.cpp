@@ -0,0 +1,179 @@
+/*******************************************************************\
+
+Module: Unit tests for reading and writing goto binaries
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/c_types.h>
+
+#include <goto-programs/goto_model.h>
+#include <goto-programs/read_bin_goto_object.h>
+#include <goto-programs/write_goto_binary.h>
+
+#include <sstream>
+
+/// Writes \p goto_model in goto binary format \p version and reads it back
+static goto_modelt write_and_read(const goto_modelt &goto_model, int version)
+{
+  std::stringstream stream;
+  REQUIRE_FALSE(write_goto_binary(stream, goto_model, version));
+
+  goto_modelt result;
+  REQUIRE_FALSE(read_bin_goto_object(
+    stream,
+    "test.gb",
+    result.symbol_table,
+    result.goto_functions,
+    null_message_handler));
+
+  return result;
+}
+
+SCENARIO("Goto binaries can be read back", "[core][goto-programs][goto_binary]")
+{
+  goto_modelt goto_model;
+  const signedbv_typet int_type(32);
+
+  symbolt x_symbol;
+  x_symbol.name = "x";
+  x_symbol.base_name = "x";
+  x_symbol.mode = ID_C;
+  x_symbol.type = int_type;
+  x_symbol.is_static_lifetime = true;
+  x_symbol.is_lvalue = true;
+  goto_model.symbol_table.add(x_symbol);
+  const symbol_exprt x = x_symbol.symbol_expr();
+
+  // two functions, sharing ireps and strings
+  for(const irep_idt name : {"main", "f"})
+  {
+    symbolt function_symbol;
+    function_symbol.name = name;
+    function_symbol.base_name = name;
+    function_symbol.mode = ID_C;
+    function_symbol.type = code_typet({}, empty_typet());
+    goto_model.symbol_table.add(function_symbol);
+
+    goto_programt &body = goto_model.goto_functions.function_map[name].body;
+    body.add(goto_programt::make_assignment(x, from_integer(0, int_type)));
+    const auto loop = body.add(goto_programt::make_assignment(
+      x, plus_exprt(x, from_integer(1, int_type))));
+    body.add(goto_programt::make_goto(
+      loop, binary_relation_exprt(x, ID_lt, from_integer(10, int_type))));
+    body.add(goto_programt::make_end_function());
+    body.update();
+  }
+
+  for(const int version : {5, GOTO_BINARY_VERSION})
+  {
+    WHEN("Using version " + std::to_string(version))
+    {
+      const goto_modelt result = write_and_read(goto_model, version);
+
+      THEN("Symbols and functions are preserved")
+      {
+        REQUIRE(result.symbol_table.symbols.size() == 3);
+        REQUIRE(result.symbol_table.lookup_ref("x").type == int_type);
+        REQUIRE(result.goto_functions.function_map.size() == 2);
+
+        for(const irep_idt name : {"main", "f"})
+        {
+          const goto_programt &body =
+            result.goto_functions.function_map.at(name).body;
+          const goto_programt &original =
+            goto_model.goto_functions.function_map.at(name).body;
+
+          REQUIRE(body.instructions.size() == original.instructions.size());
+
+          auto it = body.instructions.begin();
+          for(const auto &instruction : original.instructions)
+          {
+            REQUIRE(it->type == instruction.type);
+            REQUIRE(it->code == instruction.code);
+            REQUIRE(it->guard == instruction.guard);
+            ++it;
+          }
+
+          const auto goto_instruction = std::next(body.instructions.begin(), 2);
+          REQUIRE(goto_instruction->is_goto());
+          REQUIRE(
+            goto_instruction->get_target() ==
+            std::next(body.instructions.begin()));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO(
+  "Goto binaries can be read lazily",
+  "[core][goto-programs][goto_binary]")
+{
+  goto_modelt goto_model;
+  const code_typet function_type({}, empty_typet());
+
+  for(const irep_idt name : {"main", "called", "pointed_to", "unused"})
+  {
+    symbolt function_symbol;
+    function_symbol.name = name;
+    function_symbol.base_name = name;
+    function_symbol.mode = ID_C;
+    function_symbol.type = function_type;
+    goto_model.symbol_table.add(function_symbol);
+  }
+
+  // a function pointer that is initialised with the address of a function
+  symbolt fp_symbol;
+  fp_symbol.name = "fp";
+  fp_symbol.base_name = "fp";
+  fp_symbol.mode = ID_C;
+  fp_symbol.type = pointer_type(function_type);
+  fp_symbol.value =
+    address_of_exprt(symbol_exprt("pointed_to", function_type));
+  fp_symbol.is_static_lifetime = true;
+  goto_model.symbol_table.add(fp_symbol);
+
+  for(const irep_idt name : {"main", "called", "pointed_to", "unused"})
+  {
+    goto_programt &body = goto_model.goto_functions.function_map[name].body;
+    if(name == "main")
+    {
+      body.add(goto_programt::make_function_call(
+        code_function_callt(symbol_exprt("called", function_type))));
+    }
+    body.add(goto_programt::make_end_function());
+    body.update();
+  }
+
+  std::stringstream stream;
+  REQUIRE_FALSE(write_goto_binary(stream, goto_model));
+
+  WHEN("Reading the functions reachable from main")
+  {
+    goto_modelt result;
+    REQUIRE_FALSE(read_bin_goto_object(
+      stream,
+      "test.gb",
+      result.symbol_table,
+      result.goto_functions,
+      {"main"},
+      null_message_handler));
+
+    THEN("Only the bodies of unreachable functions are missing")
+    {
+      const auto &function_map = result.goto_functions.function_map;
+      REQUIRE(function_map.size() == 4);
+      REQUIRE(function_map.at("main").body_available());
+      REQUIRE(function_map.at("called").body_available());
+      REQUIRE(function_map.at("pointed_to").body_available());
+      REQUIRE_FALSE(function_map.at("unused").body_available());
+      REQUIRE(result.symbol_table.has_symbol("unused"));
+    }
+  }
+}
@@ -0,0 +1,169 @@
+/*******************************************************************\
+
+Module: Unit tests for function_summariest
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for function_summariest
+
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/namespace.h>
+#include <util/std_types.h>
+#include <util/symbol_table.h>
+
+#include <goto-symex/function_summaries.h>
+
+SCENARIO(
+  "function_summaries_summarisable",
+  "[core][goto-symex][function_summaries]")
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet int_type(32);
+  const symbol_exprt x("f::x", int_type);
+  const symbol_exprt y("f::y", int_type);
+  const symbol_exprt t("f::1::t", int_type);
+  const symbol_exprt g("g", int_type);
+  const symbol_exprt return_value("f#return_value", int_type);
+
+  for(const auto &symbol_expr : {x, y, t, g, return_value})
+  {
+    symbolt symbol;
+    symbol.name = symbol_expr.get_identifier();
+    symbol.base_name = symbol.name;
+    symbol.type = symbol_expr.type();
+    symbol.is_static_lifetime =
+      symbol_expr == g || symbol_expr == return_value;
+    symbol_table.add(symbol);
+  }
+
+  goto_functionst::goto_functiont goto_function;
+  goto_function.parameter_identifiers = {x.get_identifier(),
+                                         y.get_identifier()};
+  goto_programt &body = goto_function.body;
+
+  auto finish = [&]() {
+    body.add(goto_programt::make_end_function());
+    body.update();
+  };
+
+  function_summariest function_summaries;
+
+  GIVEN("A function computing its result from its parameters")
+  {
+    body.add(goto_programt::make_decl(t));
+    body.add(goto_programt::make_assignment(t, plus_exprt(x, y)));
+    body.add(goto_programt::make_assignment(return_value, t));
+    finish();
+
+    const auto &result =
+      function_summaries.summarisable("f", goto_function, ns);
+    REQUIRE(result.has_value());
+    REQUIRE(!result->has_jumps);
+    REQUIRE(result->read_globals.empty());
+  }
+
+  GIVEN("A function reading a global variable")
+  {
+    body.add(goto_programt::make_assignment(return_value, plus_exprt(x, g)));
+    finish();
+
+    const auto &result =
+      function_summaries.summarisable("f", goto_function, ns);
+    REQUIRE(result.has_value());
+    REQUIRE(result->read_globals == std::vector<symbol_exprt>{g});
+  }
+
+  GIVEN("A function writing a global variable")
+  {
+    body.add(goto_programt::make_assignment(g, x));
+    body.add(goto_programt::make_assignment(return_value, x));
+    finish();
+
+    REQUIRE(!function_summaries.summarisable("f", goto_function, ns));
+  }
+
+  GIVEN("A function containing an assertion")
+  {
+    body.add(goto_programt::make_assertion(equal_exprt(x, y)));
+    body.add(goto_programt::make_assignment(return_value, x));
+    finish();
+
+    REQUIRE(!function_summaries.summarisable("f", goto_function, ns));
+  }
+
+  GIVEN("A local variable assigned on both branches")
+  {
+    body.add(goto_programt::make_decl(t));
+    auto jump = body.add(goto_programt::make_goto(
+      body.instructions.end(), binary_relation_exprt(x, ID_lt, y)));
+    body.add(goto_programt::make_assignment(t, from_integer(1, int_type)));
+    auto skip = body.add(goto_programt::make_goto(body.instructions.end()));
+    jump->set_target(
+      body.add(goto_programt::make_assignment(t, from_integer(2, int_type))));
+    skip->set_target(
+      body.add(goto_programt::make_assignment(return_value, t)));
+    finish();
+
+    const auto &result =
+      function_summaries.summarisable("f", goto_function, ns);
+    REQUIRE(result.has_value());
+    REQUIRE(result->has_jumps);
+  }
+
+  GIVEN("A local variable assigned on one branch only")
+  {
+    body.add(goto_programt::make_decl(t));
+    auto jump = body.add(goto_programt::make_goto(
+      body.instructions.end(), binary_relation_exprt(x, ID_lt, y)));
+    body.add(goto_programt::make_assignment(t, from_integer(1, int_type)));
+    jump->set_target(
+      body.add(goto_programt::make_assignment(return_value, t)));
+    finish();
+
+    REQUIRE(!function_summaries.summarisable("f", goto_function, ns));
+  }
+
+  GIVEN("A function not assigning its return value")
+  {
+    body.add(goto_programt::make_skip());
+    finish();
+
+    REQUIRE(!function_summaries.summarisable("f", goto_function, ns));
+  }
+}
+
+SCENARIO("function_summaries_find", "[core][goto-symex][function_summaries]")
+{
+  const signedbv_typet int_type(32);
+  const exprt one = from_integer(1, int_type);
+  const exprt two = from_integer(2, int_type);
+
+  function_summariest function_summaries;
+  function_summaries.insert(function_summariest::make_key("f", {one}), two);
+
+  REQUIRE(function_summaries.recorded == 1);
+  REQUIRE(
+    function_summaries.find(function_summariest::make_key("f", {two})) ==
+    nullptr);
+  REQUIRE(
+    function_summaries.find(function_summariest::make_key("g", {one})) ==
+    nullptr);
+
+  const exprt *found =
+    function_summaries.find(function_summariest::make_key("f", {one}));
+  REQUIRE(found != nullptr);
+  REQUIRE(*found == two);
+  REQUIRE(function_summaries.hits == 1);
+
+  function_summaries.clear();
+  REQUIRE(
+    function_summaries.find(function_summariest::make_key("f", {one})) ==
+    nullptr);
+}
@@ -0,0 +1,118 @@
+/*******************************************************************\
+
+Module: Unit tests for simplify_equation
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for simplify_equation
+
+#include <testing-utils/message.h>
+#include <testing-utils/use_catch.h>
+
+#include <util/arith_tools.h>
+#include <util/std_types.h>
+#include <util/namespace.h>
+#include <util/ssa_expr.h>
+#include <util/symbol_table.h>
+
+#include <goto-symex/simplify_equation.h>
+#include <goto-symex/symex_target_equation.h>
+
+SCENARIO("simplify_equation", "[core][goto-symex][simplify_equation]")
+{
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet int_type(32);
+  const symbol_exprt g_symbol("g", bool_typet());
+  const symbol_exprt x_symbol("x", int_type);
+  const symbol_exprt y_symbol("y", int_type);
+  const symbol_exprt z_symbol("z", int_type);
+
+  goto_programt goto_program;
+  goto_program.add_instruction(END_FUNCTION);
+  symex_targett::sourcet source("f", goto_program);
+  symex_target_equationt equation(null_message_handler);
+
+  GIVEN("A merge of two constants and copies of it")
+  {
+    // x#1 = g ? 1 : 2; y#1 = x#1; z#1 = y#1 + 1
+    ssa_exprt x(x_symbol), y(y_symbol), z(z_symbol);
+    x.set_level_2(1);
+    y.set_level_2(1);
+    z.set_level_2(1);
+
+    const if_exprt choice(
+      g_symbol, from_integer(1, int_type), from_integer(2, int_type));
+
+    equation.assignment(
+      true_exprt(),
+      x,
+      x,
+      x_symbol,
+      choice,
+      source,
+      symex_targett::assignment_typet::STATE);
+    equation.assignment(
+      true_exprt(),
+      y,
+      y,
+      y_symbol,
+      x,
+      source,
+      symex_targett::assignment_typet::STATE);
+    equation.assignment(
+      true_exprt(),
+      z,
+      z,
+      z_symbol,
+      plus_exprt(y, from_integer(1, int_type)),
+      source,
+      symex_targett::assignment_typet::STATE);
+
+    WHEN("A condition compares the copy to a constant")
+    {
+      equation.assertion(
+        true_exprt(),
+        equal_exprt(y, from_integer(1, int_type)),
+        "property",
+        source);
+
+      const auto statistics = simplify_equation(equation, ns);
+
+      THEN("The condition is the condition of the merge")
+      {
+        REQUIRE(equation.SSA_steps.back().cond_expr == g_symbol);
+        REQUIRE(statistics.propagated_symbols == 3);
+      }
+      THEN("Arithmetic is lifted into the branches")
+      {
+        const auto &z_step = *std::next(equation.SSA_steps.begin(), 2);
+        REQUIRE(
+          z_step.ssa_rhs ==
+          if_exprt(
+            g_symbol, from_integer(2, int_type), from_integer(3, int_type)));
+      }
+    }
+
+    WHEN("A condition compares the copy to a value it cannot have")
+    {
+      equation.assertion(
+        true_exprt(),
+        equal_exprt(y, from_integer(3, int_type)),
+        "property",
+        source);
+
+      const auto statistics = simplify_equation(equation, ns);
+
+      THEN("The condition is decided")
+      {
+        REQUIRE(equation.SSA_steps.back().cond_expr.is_false());
+        REQUIRE(statistics.decided_conditions == 1);
+      }
+    }
+  }
+}
@@ -0,0 +1,85 @@
+/*******************************************************************\
+
+Module: Unit tests for binary_cnf
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for binary_cnf
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/sat/binary_cnf.h>
+#include <solvers/sat/dimacs_cnf.h>
+#include <util/cout_message.h>
+#include <util/exception_utils.h>
+
+#include <sstream>
+
+SCENARIO("binary_cnf", "[core][solvers][sat][binary_cnf]")
+{
+  console_message_handlert message_handler;
+
+  GIVEN("A formula with a wide range of variables")
+  {
+    dimacs_cnft original(message_handler);
+    bvt variables;
+    for(std::size_t i = 0; i < 1000; ++i)
+      variables.push_back(original.new_variable());
+
+    original.lcnf({variables[0], !variables[999]});
+    original.lcnf({!variables[1], variables[500], variables[2]});
+    original.l_set_to_true(original.land(variables[3], variables[998]));
+
+    THEN("it is read back unchanged")
+    {
+      std::stringstream stream;
+      binary_cnf_writert writer(stream, message_handler);
+      original.copy_to(writer);
+      writer.write_header();
+
+      REQUIRE(writer.no_clauses() == original.no_clauses());
+
+      dimacs_cnft copy(message_handler);
+      read_binary_cnf(stream, copy);
+
+      REQUIRE(copy.no_variables() == original.no_variables());
+      REQUIRE(copy.get_clauses() == original.get_clauses());
+    }
+  }
+
+  GIVEN("Input that is not in binary CNF format")
+  {
+    std::istringstream stream("p cnf 1 1\n1 0\n");
+    dimacs_cnft dest(message_handler);
+
+    THEN("reading it fails")
+    {
+      REQUIRE_THROWS_AS(
+        read_binary_cnf(stream, dest), deserialization_exceptiont);
+    }
+  }
+
+  GIVEN("A truncated clause")
+  {
+    std::stringstream stream;
+    {
+      binary_cnf_writert writer(stream, message_handler);
+      literalt a = writer.new_variable();
+      literalt b = writer.new_variable();
+      writer.lcnf({a, b});
+      writer.write_header();
+    }
+    std::string truncated = stream.str();
+    truncated.pop_back();
+    std::istringstream in(truncated);
+    dimacs_cnft dest(message_handler);
+
+    THEN("reading it fails")
+    {
+      REQUIRE_THROWS_AS(read_binary_cnf(in, dest), deserialization_exceptiont);
+    }
+  }
+}
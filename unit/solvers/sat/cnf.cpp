@@ -0,0 +1,59 @@
+/*******************************************************************\
+
+Module: Unit tests for cnf
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for cnf
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/sat/dimacs_cnf.h>
+#include <util/cout_message.h>
+
+SCENARIO("cnf_structural_hashing", "[core][solvers][sat][cnf]")
+{
+  console_message_handlert message_handler;
+  dimacs_cnft cnf(message_handler);
+  cnf.set_structural_hashing(true);
+
+  literalt a = cnf.new_variable();
+  literalt b = cnf.new_variable();
+
+  GIVEN("Gates over the same inputs")
+  {
+    const literalt g = cnf.land(a, b);
+    const std::size_t clauses = cnf.no_clauses();
+
+    THEN("they share their output and clauses")
+    {
+      REQUIRE(cnf.land(b, a) == g);
+      REQUIRE(cnf.lor(!a, !b) == !g);
+      REQUIRE(cnf.lnand(a, b) == !g);
+      REQUIRE(cnf.lxor(a, b) == !cnf.lxor(!a, b));
+      REQUIRE(cnf.lequal(a, b) == cnf.lxor(!a, b));
+      REQUIRE(cnf.land(a, !b) != g);
+    }
+    THEN("AND gates are rewritten")
+    {
+      REQUIRE(cnf.land(a, g) == g);
+      REQUIRE(cnf.land(!a, g).is_false());
+      REQUIRE(cnf.land(!a, !g) == !a);
+      REQUIRE(cnf.land(a, !a).is_false());
+      REQUIRE(cnf.no_clauses() == clauses);
+    }
+  }
+
+  GIVEN("Structural hashing is disabled")
+  {
+    cnf.set_structural_hashing(false);
+
+    THEN("each gate gets its own output")
+    {
+      REQUIRE(cnf.land(a, b) != cnf.land(a, b));
+    }
+  }
+}
@@ -0,0 +1,154 @@
+/*******************************************************************\
+
+Module: Unit tests for cnf_preprocessor
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for cnf_preprocessor
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/sat/cnf_preprocessor.h>
+#include <util/cout_message.h>
+
+static bool is_satisfied(const bvt &clause, const std::vector<tvt> &assignment)
+{
+  for(const auto l : clause)
+  {
+    if(assignment[l.var_no()].is_true() != l.sign())
+      return true;
+  }
+  return false;
+}
+
+/// Enumerates the assignments to variables 1 to no_variables - 1 and
+/// returns the first one that satisfies \p clauses and \p assumption
+static bool brute_force(
+  const std::vector<bvt> &clauses,
+  std::size_t no_variables,
+  literalt assumption,
+  std::vector<tvt> &assignment)
+{
+  for(unsigned bits = 0; bits < (1u << (no_variables - 1)); ++bits)
+  {
+    assignment.assign(no_variables, tvt(false));
+    for(unsigned v = 1; v < no_variables; ++v)
+      assignment[v] = tvt(((bits >> (v - 1)) & 1) != 0);
+
+    if(
+      is_satisfied({assumption}, assignment) &&
+      std::all_of(clauses.begin(), clauses.end(), [&](const bvt &clause) {
+        return is_satisfied(clause, assignment);
+      }))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+SCENARIO("cnf_preprocessor", "[core][solvers][sat][cnf_preprocessor]")
+{
+  null_message_handlert message_handler;
+  const std::size_t no_variables = 9;
+
+  GIVEN("Random 3-CNF formulas with a frozen variable")
+  {
+    unsigned seed = 1;
+    auto random = [&seed](unsigned bound) {
+      seed = seed * 1103515245 + 12345;
+      return (seed >> 16) % bound;
+    };
+
+    THEN("satisfiability is preserved under assumptions on it")
+    {
+      for(int round = 0; round < 200; ++round)
+      {
+        std::vector<bvt> original;
+        const unsigned number_of_clauses = 10 + random(30);
+        for(unsigned c = 0; c < number_of_clauses; ++c)
+        {
+          bvt clause;
+          const unsigned length = 1 + random(3);
+          for(unsigned i = 0; i < length; ++i)
+          {
+            clause.push_back(literalt(
+              1 + random(no_variables - 1), random(2) != 0));
+          }
+          original.push_back(clause);
+        }
+
+        const literalt frozen(1, false);
+
+        for(const literalt assumption : {frozen, !frozen})
+        {
+          std::vector<tvt> assignment;
+          const bool original_sat =
+            brute_force(original, no_variables, assumption, assignment);
+
+          cnf_preprocessort preprocessor(no_variables, message_handler);
+          preprocessor.set_frozen(frozen);
+          std::vector<bvt> simplified = original;
+
+          if(!preprocessor(simplified))
+          {
+            REQUIRE_FALSE(original_sat);
+            continue;
+          }
+
+          const bool simplified_sat =
+            brute_force(simplified, no_variables, assumption, assignment);
+          REQUIRE(simplified_sat == original_sat);
+
+          if(simplified_sat)
+          {
+            preprocessor.extend_assignment(assignment);
+            REQUIRE(is_satisfied({assumption}, assignment));
+            for(const auto &clause : original)
+              REQUIRE(is_satisfied(clause, assignment));
+          }
+        }
+      }
+    }
+  }
+
+  GIVEN("Equivalences that contradict each other")
+  {
+    // a == b and b == !a
+    const literalt a(1, false), b(2, false);
+    std::vector<bvt> clauses = {{!a, b}, {a, !b}, {!b, !a}, {b, a}};
+
+    THEN("the formula is found to be unsatisfiable")
+    {
+      cnf_preprocessort preprocessor(no_variables, message_handler);
+      REQUIRE_FALSE(preprocessor(clauses));
+    }
+  }
+
+  GIVEN("Equivalent literals")
+  {
+    // a == b == !c, and a or d
+    const literalt a(1, false), b(2, false), c(3, false), d(4, false);
+    std::vector<bvt> clauses = {{!a, b}, {a, !b}, {!b, !c}, {b, c}, {a, d}};
+
+    THEN("only the frozen variables remain")
+    {
+      cnf_preprocessort preprocessor(no_variables, message_handler);
+      preprocessor.set_frozen(c);
+      preprocessor.set_frozen(d);
+      REQUIRE(preprocessor(clauses));
+      REQUIRE(clauses.size() == 1);
+      REQUIRE(clauses.front() == bvt{!c, d});
+
+      std::vector<tvt> assignment(no_variables, tvt(false));
+      assignment[4] = tvt(true);
+      preprocessor.extend_assignment(assignment);
+      REQUIRE(assignment[1].is_true());
+      REQUIRE(assignment[2].is_true());
+    }
+  }
+}
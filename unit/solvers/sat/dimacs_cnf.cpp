@@ -0,0 +1,57 @@
+/*******************************************************************\
+
+Module: Unit tests for dimacs_cnf
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for dimacs_cnf
+
+#include <testing-utils/use_catch.h>
+
+#include <solvers/sat/dimacs_cnf.h>
+#include <util/cout_message.h>
+
+#include <sstream>
+
+SCENARIO("dimacs_cnf_stream", "[core][solvers][sat][dimacs_cnf]")
+{
+  console_message_handlert message_handler;
+  std::stringstream out;
+
+  GIVEN("A stream that clauses have been written to")
+  {
+    dimacs_cnf_streamt dimacs(out, message_handler);
+    literalt a = dimacs.new_variable();
+    literalt b = dimacs.new_variable();
+    dimacs.lcnf({a, b});
+    dimacs.lcnf({!a, b});
+    // tautologies are dropped
+    dimacs.lcnf({a, !a});
+
+    THEN("the counts are filled in and the clauses are kept")
+    {
+      dimacs.write_problem_line();
+      out << "c end\n";
+
+      std::string problem_line;
+      std::getline(out, problem_line);
+      std::istringstream problem(problem_line);
+      std::string p, cnf;
+      std::size_t variables, clauses;
+      problem >> p >> cnf >> variables >> clauses;
+
+      REQUIRE(p == "p");
+      REQUIRE(cnf == "cnf");
+      REQUIRE(variables == 2);
+      REQUIRE(clauses == 2);
+      REQUIRE(dimacs.no_clauses() == 2);
+
+      std::ostringstream rest;
+      rest << out.rdbuf();
+      REQUIRE(rest.str() == "1 2 0\n-1 2 0\nc end\n");
+    }
+  }
+}
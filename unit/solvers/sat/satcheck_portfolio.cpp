@@ -0,0 +1,77 @@
+/*******************************************************************\
+
+Module: Unit tests for satcheck_portfolio
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+/// \file
+/// Unit tests for satcheck_portfolio
+
+#ifdef HAVE_MINISAT2
+
+#  include <testing-utils/use_catch.h>
+
+#  include <solvers/prop/literal.h>
+#  include <solvers/sat/satcheck_minisat2.h>
+#  include <solvers/sat/satcheck_portfolio.h>
+#  include <util/cout_message.h>
+#  include <util/make_unique.h>
+
+static std::vector<satcheck_portfoliot::solver_configt> minisat_portfolio()
+{
+  return {{"minisat2",
+           [](message_handlert &message_handler) {
+             return std::unique_ptr<cnft>(
+               util_make_unique<satcheck_minisat_simplifiert>(
+                 message_handler));
+           }},
+          {"minisat2-no-simplifier", [](message_handlert &message_handler) {
+             return std::unique_ptr<cnft>(
+               util_make_unique<satcheck_minisat_no_simplifiert>(
+                 message_handler));
+           }}};
+}
+
+SCENARIO("satcheck_portfolio", "[core][solvers][sat][satcheck_portfolio]")
+{
+  console_message_handlert message_handler;
+
+  GIVEN("A satisfiable formula a && !b")
+  {
+    satcheck_portfoliot satcheck(minisat_portfolio(), message_handler);
+    literalt a = satcheck.new_variable();
+    literalt b = satcheck.new_variable();
+    satcheck.l_set_to_true(satcheck.land(a, !b));
+
+    THEN("the model of the first solver to finish is used")
+    {
+      REQUIRE(satcheck.prop_solve() == propt::resultt::P_SATISFIABLE);
+      REQUIRE(satcheck.l_get(a).is_true());
+      REQUIRE(satcheck.l_get(b).is_false());
+    }
+    THEN("is unsatisfiable under assumption b")
+    {
+      bvt assumptions;
+      assumptions.push_back(b);
+      satcheck.set_assumptions(assumptions);
+      REQUIRE(satcheck.prop_solve() == propt::resultt::P_UNSATISFIABLE);
+      REQUIRE(satcheck.is_in_conflict(b));
+    }
+  }
+
+  GIVEN("An unsatisfiable formula f && !f")
+  {
+    satcheck_portfoliot satcheck(minisat_portfolio(), message_handler);
+    literalt f = satcheck.new_variable();
+    satcheck.l_set_to_true(satcheck.land(f, !f));
+
+    THEN("is indeed unsatisfiable")
+    {
+      REQUIRE(satcheck.prop_solve() == propt::resultt::P_UNSATISFIABLE);
+    }
+  }
+}
+
+#endif
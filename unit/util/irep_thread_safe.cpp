@@ -0,0 +1,127 @@
+/*******************************************************************\
+
+Module: Unit tests and micro-benchmark for IREP_THREAD_SAFE
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/irep.h>
+#include <util/std_expr.h>
+#include <util/std_types.h>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#ifdef IREP_THREAD_SAFE
+#  include <thread>
+
+TEST_CASE(
+  "ireps and strings can be shared between threads",
+  "[core][util][irep]")
+{
+  const signedbv_typet type(32);
+  const exprt expr =
+    plus_exprt(symbol_exprt("a", type), symbol_exprt("b", type));
+
+  const std::size_t number_of_threads = 4;
+  const std::size_t iterations = 10000;
+
+  std::vector<std::thread> threads;
+  std::vector<std::vector<irep_idt>> ids(number_of_threads);
+
+  for(std::size_t t = 0; t < number_of_threads; ++t)
+  {
+    threads.emplace_back([&expr, &ids, t]() {
+      for(std::size_t i = 0; i < iterations; ++i)
+      {
+        exprt copy = expr;
+        exprt other = copy.operands().front();
+        other.id(ID_minus);
+        ids[t].push_back("thread_safe_" + std::to_string(i % 1000));
+      }
+    });
+  }
+
+  for(auto &thread : threads)
+    thread.join();
+
+  REQUIRE(expr.read().ref_count == 1);
+  REQUIRE(expr.operands().front().id() == ID_symbol);
+
+  // every thread sees the same numbers for the same strings
+  for(std::size_t t = 1; t < number_of_threads; ++t)
+    REQUIRE(ids[t] == ids[0]);
+  REQUIRE(id2string(ids[0][999]) == "thread_safe_999");
+}
+#endif
+
+/// Run using `unit "[benchmark]"` in builds with and without
+/// IREP_THREAD_SAFE to compare the single-threaded overhead.
+TEST_CASE("irep reference counting benchmark", "[.][benchmark][util][irep]")
+{
+  using clockt = std::chrono::steady_clock;
+
+  const signedbv_typet type(32);
+  exprt expr = symbol_exprt("x", type);
+  for(std::size_t i = 0; i < 16; ++i)
+    expr = plus_exprt(expr, expr);
+
+  const exprt &operand = to_plus_expr(expr).op0();
+  const std::size_t copies = 10000000;
+
+  const auto copy_start = clockt::now();
+  {
+    std::vector<exprt> exprs;
+    exprs.reserve(copies / 10);
+    for(std::size_t i = 0; i < copies; ++i)
+    {
+      if(exprs.size() == copies / 10)
+        exprs.clear();
+      exprs.push_back(operand);
+    }
+  }
+  const auto copy_stop = clockt::now();
+
+  const auto detach_start = clockt::now();
+  for(std::size_t i = 0; i < 100000; ++i)
+  {
+    exprt copy = expr;
+    // unshares the left spine of the expression
+    exprt *e = &copy;
+    while(e->has_operands())
+    {
+      e->id(ID_minus);
+      e = &e->operands().front();
+    }
+  }
+  const auto detach_stop = clockt::now();
+
+  const auto intern_start = clockt::now();
+  std::size_t length = 0;
+  for(std::size_t i = 0; i < 1000000; ++i)
+  {
+    const irep_idt id = "benchmark_" + std::to_string(i % 100000);
+    length += id2string(id).size();
+  }
+  const auto intern_stop = clockt::now();
+
+  using secondst = std::chrono::duration<double>;
+  std::cout << "IREP_THREAD_SAFE: "
+#ifdef IREP_THREAD_SAFE
+            << "on\n"
+#else
+            << "off\n"
+#endif
+            << "copy/destroy: " << secondst(copy_stop - copy_start).count()
+            << "s\n"
+            << "detach: " << secondst(detach_stop - detach_start).count()
+            << "s\n"
+            << "intern/lookup: " << secondst(intern_stop - intern_start).count()
+            << "s\n";
+
+  REQUIRE(length > 0);
+}
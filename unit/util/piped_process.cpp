@@ -0,0 +1,71 @@
+/*******************************************************************\
+
+Module: Unit tests for piped_process.h
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/piped_process.h>
+
+#include <string>
+
+TEST_CASE("piped_processt", "[core][util][piped_process]")
+{
+  if(!piped_processt::is_supported())
+    return;
+
+  SECTION("Replies are read while the process keeps running")
+  {
+    piped_processt process({"cat"});
+
+    std::string line;
+
+    REQUIRE(process.send("first\n"));
+    REQUIRE(std::getline(process.output(), line));
+    REQUIRE(line == "first");
+
+    REQUIRE(process.send("second\n"));
+    REQUIRE(std::getline(process.output(), line));
+    REQUIRE(line == "second");
+  }
+
+  SECTION("Output is read while sending large input")
+  {
+    piped_processt process({"cat"});
+
+    // exceeds the capacity of both pipes
+    const std::string data(1 << 20, 'x');
+    REQUIRE(process.send(data + "\n"));
+
+    std::string line;
+    REQUIRE(std::getline(process.output(), line));
+    REQUIRE(line == data);
+  }
+
+  SECTION("Waiting for output times out")
+  {
+    piped_processt process({"cat"});
+
+    REQUIRE_FALSE(process.wait_for_output(std::chrono::milliseconds(10)));
+
+    REQUIRE(process.send("reply\n"));
+    REQUIRE(process.wait_for_output(std::chrono::seconds(10)));
+
+    std::string line;
+    REQUIRE(std::getline(process.output(), line));
+    REQUIRE(line == "reply");
+  }
+
+  SECTION("A missing executable results in end-of-file")
+  {
+    piped_processt process({"cbmc-no-such-executable"});
+
+    process.send("input\n");
+
+    std::string line;
+    REQUIRE_FALSE(std::getline(process.output(), line));
+  }
+}
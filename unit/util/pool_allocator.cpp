@@ -0,0 +1,113 @@
+/*******************************************************************\
+
+Module: Unit tests for fixed_size_poolt
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/irep.h>
+#include <util/pool_allocator.h>
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+TEST_CASE("fixed_size_poolt reuses freed objects", "[core][util][pool]")
+{
+  using poolt = fixed_size_poolt<24, 8>;
+
+  void *first = poolt::allocate();
+  void *second = poolt::allocate();
+  REQUIRE(first != second);
+
+  poolt::deallocate(first);
+  REQUIRE(poolt::allocate() == first);
+
+  poolt::deallocate(first);
+  poolt::deallocate(second);
+}
+
+TEST_CASE(
+  "fixed_size_poolt returns distinct aligned objects",
+  "[core][util][pool]")
+{
+  using poolt = fixed_size_poolt<20, 16>;
+
+  // more than fit into a single block
+  const std::size_t count = 10000;
+  std::vector<void *> objects;
+  for(std::size_t i = 0; i < count; ++i)
+    objects.push_back(poolt::allocate());
+
+  REQUIRE(std::set<void *>(objects.begin(), objects.end()).size() == count);
+  for(const auto object : objects)
+    REQUIRE(reinterpret_cast<std::uintptr_t>(object) % 16 == 0);
+
+  for(const auto object : objects)
+    poolt::deallocate(object);
+}
+
+#ifdef IREP_THREAD_SAFE
+#  include <thread>
+
+TEST_CASE(
+  "fixed_size_poolt reuses objects freed by other threads",
+  "[core][util][pool]")
+{
+  using poolt = fixed_size_poolt<40, 8>;
+
+  const std::size_t count = 10000;
+  std::vector<void *> objects;
+
+  std::thread allocating_thread([&objects]() {
+    for(std::size_t i = 0; i < count; ++i)
+      objects.push_back(poolt::allocate());
+  });
+  allocating_thread.join();
+
+  std::thread freeing_thread([&objects]() {
+    for(const auto object : objects)
+      poolt::deallocate(object);
+  });
+  freeing_thread.join();
+
+  // all objects have been passed on to the shared free list, hence no new
+  // memory is needed
+  const std::set<void *> freed(objects.begin(), objects.end());
+  std::vector<void *> reused;
+
+  std::thread reusing_thread([&reused]() {
+    for(std::size_t i = 0; i < count; ++i)
+      reused.push_back(poolt::allocate());
+  });
+  reusing_thread.join();
+
+  for(const auto object : reused)
+    REQUIRE(freed.count(object) == 1);
+
+  for(const auto object : reused)
+    poolt::deallocate(object);
+}
+#endif
+
+TEST_CASE("ireps can be copied and modified", "[core][util][pool]")
+{
+  irept a("a");
+  for(std::size_t i = 0; i < 1000; ++i)
+  {
+    irept b("b");
+    b.get_sub().push_back(a);
+    b.set("i", i);
+    a = b;
+  }
+
+  irept copy = a;
+  copy.id("c");
+
+  REQUIRE(a.id() == "b");
+  REQUIRE(copy.id() == "c");
+  REQUIRE(copy.get_sub().front() == a.get_sub().front());
+}
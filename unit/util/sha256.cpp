@@ -0,0 +1,42 @@
+/*******************************************************************\
+
+Module: Unit tests for sha256t
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/sha256.h>
+
+TEST_CASE("SHA-256 of the FIPS 180 test vectors", "[core][util][sha256]")
+{
+  REQUIRE(
+    sha256t::hex_digest("") ==
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+  REQUIRE(
+    sha256t::hex_digest("abc") ==
+    "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  REQUIRE(
+    sha256t::hex_digest(
+      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+    "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  REQUIRE(
+    sha256t::hex_digest(std::string(1000000, 'a')) ==
+    "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST_CASE("SHA-256 of data passed in pieces", "[core][util][sha256]")
+{
+  const std::string data =
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+
+  for(std::size_t split = 0; split <= data.size(); ++split)
+  {
+    sha256t sha256;
+    sha256.update(data.substr(0, split));
+    sha256.update(data.substr(split));
+    REQUIRE(sha256t::to_hex(sha256.digest()) == sha256t::hex_digest(data));
+  }
+}
@@ -500,3 +500,62 @@ TEST_CASE("Simplifying cast expressions", "[core][util]")
     REQUIRE(simplified_expr == expr);
   }
 }
+
+TEST_CASE("Simplifying with a cache", "[core][util]")
+{
+  config.set_arch("none");
+
+  symbol_tablet symbol_table;
+  namespacet ns(symbol_table);
+
+  const signedbv_typet int_type(32);
+  const symbol_exprt x("x", int_type);
+  // (x + 0) * 1
+  const mult_exprt expr{plus_exprt{x, from_integer(0, int_type)},
+                        from_integer(1, int_type)};
+  // x + y, which cannot be simplified
+  const plus_exprt other{x, symbol_exprt{"y", int_type}};
+
+  SECTION("Results are reused")
+  {
+    simplify_expr_cachet cache(100);
+
+    REQUIRE(simplify_expr(expr, ns, cache) == x);
+    REQUIRE(cache.hits == 0);
+    REQUIRE(cache.size() == 2);
+
+    REQUIRE(simplify_expr(expr, ns, cache) == x);
+    REQUIRE(cache.hits == 1);
+
+    REQUIRE(simplify_expr(other, ns, cache) == other);
+    REQUIRE(simplify_expr(other, ns, cache) == other);
+    REQUIRE(cache.hits == 2);
+
+    exprt unchanged = other;
+    REQUIRE(simplify(unchanged, ns, cache));
+  }
+
+  SECTION("The least recently used entry is evicted")
+  {
+    simplify_expr_cachet cache(2);
+
+    simplify_expr(expr, ns, cache);
+    simplify_expr(other, ns, cache);
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.evictions == 1);
+
+    // the operand was evicted, but the outermost expression is still cached
+    REQUIRE(simplify_expr(expr, ns, cache) == x);
+    REQUIRE(cache.hits == 1);
+  }
+
+  SECTION("A cache of size 0 is disabled")
+  {
+    simplify_expr_cachet cache(0);
+
+    REQUIRE(simplify_expr(expr, ns, cache) == x);
+    REQUIRE(simplify_expr(expr, ns, cache) == x);
+    REQUIRE(cache.size() == 0);
+    REQUIRE(cache.hits + cache.misses == 0);
+  }
+}
@@ -0,0 +1,101 @@
+/*******************************************************************\
+
+Module: Unit tests for worker_process.h
+
+Author: agent, agent@local
+
+\*******************************************************************/
+
+#include <testing-utils/use_catch.h>
+
+#include <util/make_unique.h>
+#include <util/worker_process.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("worker_processt", "[core][util][worker_process]")
+{
+  if(!worker_processt::is_supported())
+    return;
+
+  SECTION("Result is passed to the parent")
+  {
+    int value = 1;
+    worker_processt worker([&value]() {
+      value = 2;
+      return std::to_string(value) + "\n" + std::string(100000, 'x');
+    });
+
+    const auto result = worker.wait();
+    REQUIRE(result.has_value());
+    REQUIRE(result->size() == 100002);
+    REQUIRE(result->substr(0, 2) == "2\n");
+
+    // the worker operates on its own copy
+    REQUIRE(value == 1);
+  }
+
+  SECTION("Exceptions in the worker are reported as failure")
+  {
+    worker_processt worker(
+      []() -> std::string { throw std::runtime_error("failure"); });
+
+    REQUIRE_FALSE(worker.wait().has_value());
+  }
+
+  SECTION("Workers are collected in the order in which they finish")
+  {
+    std::vector<std::unique_ptr<worker_processt>> workers;
+    workers.push_back(util_make_unique<worker_processt>([]() {
+      while(true)
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+      return std::string();
+    }));
+    workers.push_back(
+      util_make_unique<worker_processt>([]() { return std::string("done"); }));
+
+    const auto ready = wait_for_any_worker(workers);
+    REQUIRE(ready.has_value());
+    REQUIRE(*ready == 1);
+    REQUIRE(workers[1]->wait() == optionalt<std::string>("done"));
+
+    workers[1] = nullptr;
+    workers[0]->kill();
+    REQUIRE(wait_for_any_worker(workers) == optionalt<std::size_t>(0));
+    REQUIRE_FALSE(workers[0]->wait().has_value());
+
+    workers[0] = nullptr;
+    REQUIRE_FALSE(wait_for_any_worker(workers).has_value());
+  }
+
+  SECTION("Slots are shared with workers")
+  {
+    worker_slotst slots(1);
+    REQUIRE(slots.try_acquire());
+    REQUIRE_FALSE(slots.try_acquire());
+
+    worker_processt worker([&slots]() {
+      slots.release();
+      return std::string();
+    });
+    REQUIRE(worker.wait().has_value());
+
+    REQUIRE(slots.try_acquire());
+    REQUIRE_FALSE(slots.try_acquire());
+  }
+
+  SECTION("Killed workers are reported as failure")
+  {
+    worker_processt worker([]() {
+      while(true)
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+      return std::string();
+    });
+
+    REQUIRE_FALSE(worker.ready());
+    worker.kill();
+    REQUIRE_FALSE(worker.wait().has_value());
+  }
+}